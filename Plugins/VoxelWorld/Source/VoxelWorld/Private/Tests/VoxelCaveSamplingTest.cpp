@@ -0,0 +1,92 @@
+// Copyright Your Company. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "VoxelTerrainGenerator.h"
+#include "UObject/Package.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelCaveSamplingTest, "VoxelWorld.Generation.CaveSamplingError",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+/**
+ * Coarse cave noise sampling against full resolution: step 1 must reproduce it exactly, and steps 2 and 4 must keep the
+ * density error and the share of samples that flip between solid and air under the bounds the sample-step settings promise
+ */
+bool FVoxelCaveSamplingTest::RunTest(const FString& Parameters)
+{
+    FVoxelWorldSettings Settings;
+    Settings.bGenerateCaves = true;
+
+    UVoxelTerrainGenerator* Generator = NewObject<UVoxelTerrainGenerator>(GetTransientPackage());
+    Generator->Initialize(Settings);
+
+    // Densities are normalized to [-1, 1] - bounds per coarsest step of the pair (index 1 = step 2, index 2 = step 4)
+    const double MaxMeanError[] = { 0.0, 0.02, 0.05 };
+    const double MaxSignChangeShare[] = { 0.0, 0.005, 0.02 };
+
+    // A 2x2 block of chunk columns up to just above the highest expected terrain
+    const int32 MaxTerrainZ = Settings.BaseTerrainHeight + Settings.TerrainAmplitude + Settings.BiomeSettings.PlateauHeight * 2;
+    const int32 MaxChunkZ = FMath::Min(Settings.WorldHeightChunks - 1, MaxTerrainZ / Settings.ChunkSize);
+
+    TArray<FChunkCoord> SampleChunks;
+    for (int32 Y = 0; Y < 2; ++Y)
+    {
+        for (int32 X = 0; X < 2; ++X)
+        {
+            for (int32 Z = 0; Z <= MaxChunkZ; ++Z)
+            {
+                SampleChunks.Add(FChunkCoord(X, Y, Z));
+            }
+        }
+    }
+
+    const FIntPoint StepCombinations[] = {
+        FIntPoint(1, 1), FIntPoint(2, 1), FIntPoint(4, 1), FIntPoint(1, 2), FIntPoint(1, 4),
+        FIntPoint(2, 2), FIntPoint(2, 4), FIntPoint(4, 4)
+    };
+
+    for (const FIntPoint& Steps : StepCombinations)
+    {
+        double ErrorSum = 0.0;
+        int64 SignChanges = 0;
+        int64 MaterialMismatches = 0;
+        int64 NumSamples = 0;
+
+        for (const FChunkCoord& Coord : SampleChunks)
+        {
+            const FVoxelSamplingErrorReport Report = Generator->MeasureCaveSamplingError(Coord, Steps.X, Steps.Y);
+            ErrorSum += (double)Report.MeanDensityError * Report.NumSamples;
+            SignChanges += Report.SignChanges;
+            MaterialMismatches += Report.MaterialMismatches;
+            NumSamples += Report.NumSamples;
+        }
+
+        if (!TestTrue(TEXT("Sampled chunks produced density"), NumSamples > 0))
+        {
+            return false;
+        }
+
+        const int32 Bound = FMath::FloorLog2(FMath::Max(Steps.X, Steps.Y));
+        const double MeanError = ErrorSum / NumSamples;
+        const double SignChangeShare = (double)SignChanges / NumSamples;
+
+        AddInfo(FString::Printf(TEXT("Cave %d / Shape %d: MeanError %.5f, SignChanges %lld (%.3f%%), MaterialMismatches %lld"),
+            Steps.X, Steps.Y, MeanError, SignChanges, 100.0 * SignChangeShare, MaterialMismatches));
+
+        TestTrue(FString::Printf(TEXT("Cave %d / Shape %d mean density error %.5f <= %.3f"), Steps.X, Steps.Y, MeanError, MaxMeanError[Bound]),
+            MeanError <= MaxMeanError[Bound]);
+        TestTrue(FString::Printf(TEXT("Cave %d / Shape %d solid/air flips %.4f <= %.3f"), Steps.X, Steps.Y, SignChangeShare, MaxSignChangeShare[Bound]),
+            SignChangeShare <= MaxSignChangeShare[Bound]);
+
+        if (Bound == 0)
+        {
+            TestEqual(TEXT("Full-resolution sampling changes no materials"), MaterialMismatches, (int64)0);
+        }
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,108 @@
+// Copyright Your Company. All Rights Reserved.
+
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+#include "VoxelTerrainGenerator.h"
+#include "Async/ParallelFor.h"
+#include "UObject/Package.h"
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelConcurrentGenerationTest, "VoxelWorld.Generation.ConcurrentDeterminism",
+    EAutomationTestFlags_ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+/**
+ * Stress the shared terrain generator: generate the same chunks from 1..MaxThreads threads at once and require
+ * every result to be bit-identical to single-threaded output (speedups are logged, not asserted)
+ */
+bool FVoxelConcurrentGenerationTest::RunTest(const FString& Parameters)
+{
+    const FVoxelWorldSettings Settings;
+    const int32 ChunkSize = Settings.ChunkSize;
+
+    // Every pool worker plus the calling thread - rarely a power of two, so the sweep ends on it explicitly
+    const int32 MaxThreads = FMath::Clamp(FTaskGraphInterface::Get().GetNumWorkerThreads() + 1, 2, 64);
+
+    // A 4x4 block of chunk columns up to just above the highest expected terrain
+    const int32 MaxTerrainZ = Settings.BaseTerrainHeight + Settings.TerrainAmplitude + Settings.BiomeSettings.PlateauHeight * 2;
+    const int32 MaxChunkZ = FMath::Min(Settings.WorldHeightChunks - 1, MaxTerrainZ / ChunkSize);
+
+    TArray<FChunkCoord> SampleChunks;
+    for (int32 Y = 0; Y < 4; ++Y)
+    {
+        for (int32 X = 0; X < 4; ++X)
+        {
+            for (int32 Z = 0; Z <= MaxChunkZ; ++Z)
+            {
+                SampleChunks.Add(FChunkCoord(X, Y, Z));
+            }
+        }
+    }
+
+    const int32 NumChunks = SampleChunks.Num();
+
+    // Each run uses a fresh generator so every thread count starts from a cold column cache
+    auto RunGeneration = [&](int32 NumThreads, TArray<TArray<float>>& OutDensity, TArray<TArray<EVoxelType>>& OutMaterials) -> double
+    {
+        UVoxelTerrainGenerator* Generator = NewObject<UVoxelTerrainGenerator>(GetTransientPackage());
+        Generator->Initialize(Settings);
+
+        OutDensity.SetNum(NumChunks);
+        OutMaterials.SetNum(NumChunks);
+
+        const double StartTime = FPlatformTime::Seconds();
+
+        // Interleave chunks across threads so stacked chunks (same columns) are generated concurrently
+        ParallelFor(NumThreads, [&](int32 ThreadIndex)
+        {
+            for (int32 Index = ThreadIndex; Index < NumChunks; Index += NumThreads)
+            {
+                const FChunkCoord& Coord = SampleChunks[Index];
+                Generator->GenerateChunkData(Coord.X * ChunkSize, Coord.Y * ChunkSize, Coord.Z * ChunkSize, ChunkSize,
+                    OutDensity[Index], OutMaterials[Index]);
+            }
+        }, NumThreads == 1 ? EParallelForFlags::ForceSingleThread : EParallelForFlags::Unbalanced);
+
+        return (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    };
+
+    TArray<TArray<float>> ReferenceDensity;
+    TArray<TArray<EVoxelType>> ReferenceMaterials;
+    const double ReferenceMs = RunGeneration(1, ReferenceDensity, ReferenceMaterials);
+
+    AddInfo(FString::Printf(TEXT("%d chunks, up to %d threads, single-threaded %.1f ms"), NumChunks, MaxThreads, ReferenceMs));
+
+    TArray<int32> ThreadCounts;
+    for (int32 NumThreads = 2; NumThreads < MaxThreads; NumThreads *= 2)
+    {
+        ThreadCounts.Add(NumThreads);
+    }
+    ThreadCounts.Add(MaxThreads);
+
+    for (const int32 NumThreads : ThreadCounts)
+    {
+        TArray<TArray<float>> Density;
+        TArray<TArray<EVoxelType>> Materials;
+        const double ElapsedMs = RunGeneration(NumThreads, Density, Materials);
+
+        int32 MismatchedChunks = 0;
+        for (int32 Index = 0; Index < NumChunks; ++Index)
+        {
+            const bool bDensityMatches = Density[Index].Num() == ReferenceDensity[Index].Num() &&
+                FMemory::Memcmp(Density[Index].GetData(), ReferenceDensity[Index].GetData(), Density[Index].Num() * sizeof(float)) == 0;
+            const bool bMaterialsMatch = Materials[Index] == ReferenceMaterials[Index];
+
+            if (!bDensityMatches || !bMaterialsMatch)
+            {
+                ++MismatchedChunks;
+            }
+        }
+
+        AddInfo(FString::Printf(TEXT("%2d threads: %.1f ms, speedup %.2fx"), NumThreads, ElapsedMs, ElapsedMs > 0.0 ? ReferenceMs / ElapsedMs : 0.0));
+        TestEqual(FString::Printf(TEXT("Chunks differing from single-threaded output at %d threads"), NumThreads), MismatchedChunks, 0);
+    }
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -40,17 +40,15 @@ void AVoxelChunk::BeginDestroy()
     // Clear mesh first to release render resources
     ClearMesh();
 
-    // Clear data arrays
-    DensityData.Empty();
-    MaterialData.Empty();
+    // Voxel data belongs to the chunk store - just let go of the entry
+    ChunkStore = nullptr;
+    DataHandle = FVoxelChunkHandle();
 
     // Clear neighbor references
-    NeighborXPos.Reset();
-    NeighborXNeg.Reset();
-    NeighborYPos.Reset();
-    NeighborYNeg.Reset();
-    NeighborZPos.Reset();
-    NeighborZNeg.Reset();
+    for (FVoxelChunkHandle& NeighborHandle : NeighborHandles)
+    {
+        NeighborHandle = FVoxelChunkHandle();
+    }
 
     Super::BeginDestroy();
 }
@@ -62,15 +60,11 @@ void AVoxelChunk::InitializeChunk(const FChunkCoord& InChunkCoord, const FVoxelW
     TerrainGenerator = InGenerator;
     ChunkState = EChunkState::Loading;
 
-    int32 ChunkSize = WorldSettings.ChunkSize;
+    MeshComponent->bUseAsyncCooking = WorldSettings.bAsyncCollisionCooking;
 
-    // Pre-allocate density data (ChunkSize+1 for interpolation)
-    int32 DensitySize = (ChunkSize + 1) * (ChunkSize + 1) * (ChunkSize + 1);
-    DensityData.SetNum(DensitySize);
+    int32 ChunkSize = WorldSettings.ChunkSize;
 
-    // Pre-allocate material data
-    int32 MaterialSize = ChunkSize * ChunkSize * ChunkSize;
-    MaterialData.SetNum(MaterialSize);
+    // No allocation here - the voxel data lives in the chunk store and is attached separately
 
     // Create marching cubes mesher
     MarchingCubes = MakeUnique<FVoxelMarchingCubes>(ChunkSize, WorldSettings.VoxelSize);
@@ -84,124 +78,184 @@ void AVoxelChunk::InitializeChunk(const FChunkCoord& InChunkCoord, const FVoxelW
     SetActorLocation(WorldPosition);
 
     bIsGenerated = false;
-    bNeedsMeshRebuild = true;
+    MarkDataChanged();
     bHasVoxelData = true;
     bPendingKill = false;
 }
 
 void AVoxelChunk::ResetChunk()
 {
-    // Reset for pooling - keep allocations but clear data
+    // Reset for pooling - the store entry stays with the coordinate, not the actor
     ChunkState = EChunkState::Unloaded;
     bIsGenerated = false;
-    bNeedsMeshRebuild = true;
+    MarkDataChanged();
     bHasVoxelData = false;
     bPendingKill = false;
     CurrentLOD = EVoxelLOD::LOD0;
+    TransitionMask = 0;
+    TransitionLevels = 0;
+
+    // Results of mesh tasks started before pooling belong to the old coordinate
+    MeshTaskId = 0;
 
     // Clear mesh
     ClearMesh();
 
-    // Zero out data but keep allocations
-    if (DensityData.Num() > 0)
-    {
-        FMemory::Memzero(DensityData.GetData(), DensityData.Num() * sizeof(float));
-    }
-    if (MaterialData.Num() > 0)
+    DataHandle = FVoxelChunkHandle();
+
+    // Clear neighbor references
+    for (FVoxelChunkHandle& NeighborHandle : NeighborHandles)
     {
-        FMemory::Memzero(MaterialData.GetData(), MaterialData.Num() * sizeof(EVoxelType));
+        NeighborHandle = FVoxelChunkHandle();
     }
+}
 
-    // Clear neighbor references
-    NeighborXPos.Reset();
-    NeighborXNeg.Reset();
-    NeighborYPos.Reset();
-    NeighborYNeg.Reset();
-    NeighborZPos.Reset();
-    NeighborZNeg.Reset();
+void AVoxelChunk::AttachData(FVoxelChunkStore* InStore, const FVoxelChunkHandle& InHandle)
+{
+    ChunkStore = InStore;
+    DataHandle = InHandle;
+}
+
+const FVoxelChunkData* AVoxelChunk::GetData() const
+{
+    return ChunkStore ? ChunkStore->Get(DataHandle) : nullptr;
+}
+
+FVoxelChunkData* AVoxelChunk::GetMutableData()
+{
+    return ChunkStore ? ChunkStore->GetMutable(DataHandle) : nullptr;
 }
 
 void AVoxelChunk::GenerateVoxelData()
+{
+    GenerateVoxelDataAtStep(GetTargetDataStep());
+}
+
+bool AVoxelChunk::GenerateVoxelDataAtStep(int32 Step)
 {
     // Check for cancellation
     if (bPendingKill)
     {
-        return;
+        return false;
     }
 
     if (!TerrainGenerator)
     {
         UE_LOG(LogVoxelWorld, Warning, TEXT("Chunk %s: No terrain generator assigned!"), *ChunkCoord.ToString());
-        return;
+        return false;
     }
 
-    int32 ChunkSize = WorldSettings.ChunkSize;
+    if (!ChunkStore || !ChunkStore->IsValid(DataHandle))
+    {
+        UE_LOG(LogVoxelWorld, Warning, TEXT("Chunk %s: No voxel data entry attached!"), *ChunkCoord.ToString());
+        return false;
+    }
 
-    int32 ChunkWorldX = ChunkCoord.X * ChunkSize;
-    int32 ChunkWorldY = ChunkCoord.Y * ChunkSize;
-    int32 ChunkWorldZ = ChunkCoord.Z * ChunkSize;
+    // Generated off to the side and swapped in whole, so in-flight mesh snapshots keep the old lattice
+    // Edits carry over and are applied on top of the new baseline
+    TSharedRef<FVoxelChunkData, ESPMode::ThreadSafe> NewData = MakeShared<FVoxelChunkData, ESPMode::ThreadSafe>();
+    if (!NewData->TakeEditsFrom(*ChunkStore->Get(DataHandle)))
+    {
+        UE_LOG(LogVoxelWorld, Warning, TEXT("Chunk %s: Could not restore edit layer"), *ChunkCoord.ToString());
+        return false;
+    }
 
-    // Generate density data
-    for (int32 LocalZ = 0; LocalZ <= ChunkSize; ++LocalZ)
+    if (!NewData->Generate(*TerrainGenerator, ChunkCoord, WorldSettings.ChunkSize, Step, WorldSettings.DensityFormat, &bPendingKill))
     {
-        // Check for cancellation periodically
-        if (bPendingKill) return;
+        return false;
+    }
 
-        int32 WorldZ = ChunkWorldZ + LocalZ;
+    ChunkStore->SetData(DataHandle, NewData);
+    NotifyDataGenerated();
 
-        for (int32 LocalY = 0; LocalY <= ChunkSize; ++LocalY)
-        {
-            int32 WorldY = ChunkWorldY + LocalY;
+    return true;
+}
 
-            for (int32 LocalX = 0; LocalX <= ChunkSize; ++LocalX)
-            {
-                int32 WorldX = ChunkWorldX + LocalX;
+void AVoxelChunk::NotifyDataGenerated()
+{
+    bIsGenerated = true;
+    bHasVoxelData = true;
+    MarkDataChanged();
+    ChunkState = EChunkState::Generated;
 
-                float Density = TerrainGenerator->GetDensity(WorldX, WorldY, WorldZ);
-                int32 Index = GetDensityIndex(LocalX, LocalY, LocalZ);
-                DensityData[Index] = Density;
-            }
-        }
+    UE_LOG(LogVoxelWorld, Verbose, TEXT("Generated voxel data for chunk %s (data step %d)"), *ChunkCoord.ToString(), GetDataStep());
+}
+
+int32 AVoxelChunk::GetDataStep() const
+{
+    const FVoxelChunkData* Data = GetData();
+    return Data ? Data->DataStep : 1;
+}
+
+int32 AVoxelChunk::GetTargetDataStep() const
+{
+    return FVoxelChunkData::GetTargetDataStep(WorldSettings, CurrentLOD);
+}
+
+bool AVoxelChunk::InvalidateCoarseData()
+{
+    if (!bIsGenerated || GetDataStep() <= GetTargetDataStep())
+    {
+        return false;
     }
 
-    // Generate material data
-    for (int32 LocalZ = 0; LocalZ < ChunkSize; ++LocalZ)
+    bIsGenerated = false;
+    return true;
+}
+
+bool AVoxelChunk::FindAirBlock(int32 LocalX, int32 LocalY, int32 LocalZ, FIntVector& OutBlockMin, int32& OutBlockSize) const
+{
+    if (!bIsGenerated || !bHasVoxelData)
     {
-        if (bPendingKill) return;
+        return false;
+    }
 
-        int32 WorldZ = ChunkWorldZ + LocalZ;
+    const FVoxelChunkData* Data = GetData();
+    return Data && Data->FindAirBlock(LocalX, LocalY, LocalZ, OutBlockMin, OutBlockSize);
+}
 
-        for (int32 LocalY = 0; LocalY < ChunkSize; ++LocalY)
-        {
-            int32 WorldY = ChunkWorldY + LocalY;
+bool AVoxelChunk::GetHomogeneousFill(FVoxelHomogeneousChunk& OutFill) const
+{
+    if (!bIsGenerated || !bHasVoxelData)
+    {
+        return false;
+    }
 
-            for (int32 LocalX = 0; LocalX < ChunkSize; ++LocalX)
-            {
-                int32 WorldX = ChunkWorldX + LocalX;
+    const FVoxelChunkData* Data = GetData();
+    return Data && Data->GetHomogeneousFill(OutFill);
+}
 
-                EVoxelType Material = TerrainGenerator->GetVoxelType(WorldX, WorldY, WorldZ);
-                int32 Index = GetMaterialIndex(LocalX, LocalY, LocalZ);
-                MaterialData[Index] = Material;
-            }
-        }
+bool AVoxelChunk::EnsureDataResident()
+{
+    if (!bHasVoxelData && bIsGenerated)
+    {
+        ReloadVoxelData();
     }
 
-    bIsGenerated = true;
-    bHasVoxelData = true;
-    bNeedsMeshRebuild = true;
-    ChunkState = EChunkState::Generated;
+    return bHasVoxelData;
+}
+
+bool AVoxelChunk::EnsureFullResolution()
+{
+    if (GetDataStep() == 1)
+    {
+        return true;
+    }
 
-    UE_LOG(LogVoxelWorld, Verbose, TEXT("Generated voxel data for chunk %s"), *ChunkCoord.ToString());
+    // Procedural data is deterministic, so regenerating is an exact upsample
+    return GenerateVoxelDataAtStep(1);
 }
 
 void AVoxelChunk::SetNeighbors(AVoxelChunk* XPos, AVoxelChunk* XNeg, AVoxelChunk* YPos, AVoxelChunk* YNeg, AVoxelChunk* ZPos, AVoxelChunk* ZNeg)
 {
-    NeighborXPos = XPos;
-    NeighborXNeg = XNeg;
-    NeighborYPos = YPos;
-    NeighborYNeg = YNeg;
-    NeighborZPos = ZPos;
-    NeighborZNeg = ZNeg;
+    auto HandleOf = [](const AVoxelChunk* Neighbor) { return Neighbor ? Neighbor->DataHandle : FVoxelChunkHandle(); };
+
+    NeighborHandles[static_cast<int32>(EVoxelChunkFace::PosX)] = HandleOf(XPos);
+    NeighborHandles[static_cast<int32>(EVoxelChunkFace::NegX)] = HandleOf(XNeg);
+    NeighborHandles[static_cast<int32>(EVoxelChunkFace::PosY)] = HandleOf(YPos);
+    NeighborHandles[static_cast<int32>(EVoxelChunkFace::NegY)] = HandleOf(YNeg);
+    NeighborHandles[static_cast<int32>(EVoxelChunkFace::PosZ)] = HandleOf(ZPos);
+    NeighborHandles[static_cast<int32>(EVoxelChunkFace::NegZ)] = HandleOf(ZNeg);
 }
 
 FVoxel AVoxelChunk::GetVoxel(int32 LocalX, int32 LocalY, int32 LocalZ) const
@@ -222,7 +276,7 @@ FVoxel AVoxelChunk::GetVoxel(int32 LocalX, int32 LocalY, int32 LocalZ) const
 
 void AVoxelChunk::SetVoxel(int32 LocalX, int32 LocalY, int32 LocalZ, const FVoxel& Voxel)
 {
-    if (!IsInBounds(LocalX, LocalY, LocalZ) || !bHasVoxelData)
+    if (!IsInBounds(LocalX, LocalY, LocalZ) || !EnsureDataResident())
     {
         return;
     }
@@ -234,137 +288,109 @@ void AVoxelChunk::SetVoxel(int32 LocalX, int32 LocalY, int32 LocalZ, const FVoxe
 
     SetDensity(LocalX, LocalY, LocalZ, Density);
 
-    bNeedsMeshRebuild = true;
+    MarkDataChanged();
 }
 
 float AVoxelChunk::GetDensity(int32 LocalX, int32 LocalY, int32 LocalZ) const
 {
-    if (!IsInDensityBounds(LocalX, LocalY, LocalZ) || !bHasVoxelData)
+    if (!bHasVoxelData)
     {
         return 1.0f;
     }
 
-    int32 Index = GetDensityIndex(LocalX, LocalY, LocalZ);
-    if (Index >= 0 && Index < DensityData.Num())
-    {
-        return DensityData[Index];
-    }
-
-    return 1.0f;
+    const FVoxelChunkData* Data = GetData();
+    return Data ? Data->GetDensity(LocalX, LocalY, LocalZ) : 1.0f;
 }
 
 void AVoxelChunk::SetDensity(int32 LocalX, int32 LocalY, int32 LocalZ, float Density)
 {
-    if (!IsInDensityBounds(LocalX, LocalY, LocalZ) || !bHasVoxelData)
+    if (!IsInDensityBounds(LocalX, LocalY, LocalZ) || !EnsureDataResident() || !EnsureFullResolution())
     {
         return;
     }
 
-    int32 Index = GetDensityIndex(LocalX, LocalY, LocalZ);
-    if (Index >= 0 && Index < DensityData.Num())
+    FVoxelChunkData* Data = GetMutableData();
+    if (!Data)
     {
-        DensityData[Index] = Density;
-        bNeedsMeshRebuild = true;
+        return;
+    }
+
+    int32 Index = Data->GetDensityIndex(LocalX, LocalY, LocalZ);
+    if (Data->DensityData.IsValidIndex(Index))
+    {
+        Data->DensityData.Set(Index, Density);
+        Data->DensityPyramid.UpdateRegion(Data->DensityData, FIntVector(LocalX, LocalY, LocalZ), FIntVector(LocalX, LocalY, LocalZ));
+        Data->Edits.SetDensity(Data->ChunkSize, LocalX, LocalY, LocalZ, Data->DensityData.Get(Index));
+        Data->bUnsavedEdits = true;
+        MarkDataChanged();
     }
 }
 
 EVoxelType AVoxelChunk::GetMaterial(int32 LocalX, int32 LocalY, int32 LocalZ) const
 {
-    if (!IsInBounds(LocalX, LocalY, LocalZ) || !bHasVoxelData)
+    if (!bHasVoxelData)
     {
         return EVoxelType::Air;
     }
 
-    int32 Index = GetMaterialIndex(LocalX, LocalY, LocalZ);
-    if (Index >= 0 && Index < MaterialData.Num())
-    {
-        return MaterialData[Index];
-    }
-
-    return EVoxelType::Air;
+    const FVoxelChunkData* Data = GetData();
+    return Data ? Data->GetMaterial(LocalX, LocalY, LocalZ) : EVoxelType::Air;
 }
 
 void AVoxelChunk::SetMaterial(int32 LocalX, int32 LocalY, int32 LocalZ, EVoxelType Material)
 {
-    if (!IsInBounds(LocalX, LocalY, LocalZ) || !bHasVoxelData)
+    if (!IsInBounds(LocalX, LocalY, LocalZ) || !EnsureDataResident() || !EnsureFullResolution())
     {
         return;
     }
 
-    int32 Index = GetMaterialIndex(LocalX, LocalY, LocalZ);
-    if (Index >= 0 && Index < MaterialData.Num())
-    {
-        MaterialData[Index] = Material;
-        bNeedsMeshRebuild = true;
-    }
-}
-
-float AVoxelChunk::GetDensityIncludingNeighbors(int32 LocalX, int32 LocalY, int32 LocalZ) const
-{
-    int32 ChunkSize = WorldSettings.ChunkSize;
-
-    if (IsInDensityBounds(LocalX, LocalY, LocalZ))
+    FVoxelChunkData* Data = GetMutableData();
+    if (!Data)
     {
-        return GetDensity(LocalX, LocalY, LocalZ);
+        return;
     }
 
-    // Check neighbors
-    if (LocalX > ChunkSize && NeighborXPos.IsValid())
-        return NeighborXPos->GetDensity(LocalX - ChunkSize, LocalY, LocalZ);
-    if (LocalX < 0 && NeighborXNeg.IsValid())
-        return NeighborXNeg->GetDensity(LocalX + ChunkSize, LocalY, LocalZ);
-    if (LocalY > ChunkSize && NeighborYPos.IsValid())
-        return NeighborYPos->GetDensity(LocalX, LocalY - ChunkSize, LocalZ);
-    if (LocalY < 0 && NeighborYNeg.IsValid())
-        return NeighborYNeg->GetDensity(LocalX, LocalY + ChunkSize, LocalZ);
-    if (LocalZ > ChunkSize && NeighborZPos.IsValid())
-        return NeighborZPos->GetDensity(LocalX, LocalY, LocalZ - ChunkSize);
-    if (LocalZ < 0 && NeighborZNeg.IsValid())
-        return NeighborZNeg->GetDensity(LocalX, LocalY, LocalZ + ChunkSize);
-
-    // FIX: Instead of returning 1.0f (air), generate the density
-    // This prevents holes at chunk boundaries when neighbors aren't loaded
-    if (TerrainGenerator)
+    int32 Index = Data->GetMaterialIndex(LocalX, LocalY, LocalZ);
+    if (Data->MaterialData.IsValidIndex(Index))
     {
-        int32 WorldX = ChunkCoord.X * ChunkSize + LocalX;
-        int32 WorldY = ChunkCoord.Y * ChunkSize + LocalY;
-        int32 WorldZ = ChunkCoord.Z * ChunkSize + LocalZ;
-        return TerrainGenerator->GetDensity(WorldX, WorldY, WorldZ);
+        Data->MaterialData.Set(Index, Material);
+        Data->Edits.SetMaterial(Data->ChunkSize, LocalX, LocalY, LocalZ, Material);
+        Data->bUnsavedEdits = true;
+        MarkDataChanged();
     }
-
-    return 1.0f;  // Fallback only if no terrain generator
 }
 
-EVoxelType AVoxelChunk::GetMaterialIncludingNeighbors(int32 LocalX, int32 LocalY, int32 LocalZ) const
+EVoxelType AVoxelChunk::GetDominantMaterial() const
 {
-    int32 ChunkSize = WorldSettings.ChunkSize;
+    const FVoxelChunkData* Data = bHasVoxelData ? GetData() : nullptr;
+    return Data ? Data->MaterialData.GetDominantMaterial() : EVoxelType::Air;
+}
 
-    if (IsInBounds(LocalX, LocalY, LocalZ))
+bool AVoxelChunk::CopyApronFrom(const AVoxelChunk& Source)
+{
+    if (&Source == this || !bHasVoxelData || !Source.bHasVoxelData || !Source.bIsGenerated)
     {
-        return GetMaterial(LocalX, LocalY, LocalZ);
+        return false;
     }
 
-    if (LocalX >= ChunkSize && NeighborXPos.IsValid())
-        return NeighborXPos->GetMaterial(LocalX - ChunkSize, LocalY, LocalZ);
-    if (LocalX < 0 && NeighborXNeg.IsValid())
-        return NeighborXNeg->GetMaterial(LocalX + ChunkSize, LocalY, LocalZ);
-    if (LocalY >= ChunkSize && NeighborYPos.IsValid())
-        return NeighborYPos->GetMaterial(LocalX, LocalY - ChunkSize, LocalZ);
-    if (LocalY < 0 && NeighborYNeg.IsValid())
-        return NeighborYNeg->GetMaterial(LocalX, LocalY + ChunkSize, LocalZ);
-    if (LocalZ >= ChunkSize && NeighborZPos.IsValid())
-        return NeighborZPos->GetMaterial(LocalX, LocalY, LocalZ - ChunkSize);
-    if (LocalZ < 0 && NeighborZNeg.IsValid())
-        return NeighborZNeg->GetMaterial(LocalX, LocalY, LocalZ + ChunkSize);
+    const FVoxelChunkData* SourceData = Source.GetData();
+    FVoxelChunkData* Data = SourceData ? GetMutableData() : nullptr;
+    if (!Data || !Data->CopyApronFrom(*SourceData))
+    {
+        return false;
+    }
 
-    return EVoxelType::Air;
+    MarkDataChanged();
+    return true;
 }
 
 void AVoxelChunk::ModifyTerrain(const FVector& LocalPosition, float Radius, float Strength, bool bAdd)
 {
-    if (!bHasVoxelData) return;
+    if (!EnsureDataResident() || !EnsureFullResolution()) return;
+
+    FVoxelChunkData* Data = GetMutableData();
+    if (!Data) return;
 
-    int32 ChunkSize = WorldSettings.ChunkSize;
     float VoxelSize = WorldSettings.VoxelSize;
 
     int32 VoxelRadius = FMath::CeilToInt(Radius / VoxelSize) + 1;
@@ -379,7 +405,8 @@ void AVoxelChunk::ModifyTerrain(const FVector& LocalPosition, float Radius, floa
         {
             for (int32 X = CenterX - VoxelRadius; X <= CenterX + VoxelRadius; ++X)
             {
-                if (!IsInDensityBounds(X, Y, Z))
+                // The apron is edited too, so this chunk's mesh reflects the edit even where a neighbour owns the voxels
+                if (!IsInPaddedDensityBounds(X, Y, Z))
                     continue;
 
                 FVector VoxelPos(X * VoxelSize, Y * VoxelSize, Z * VoxelSize);
@@ -392,22 +419,25 @@ void AVoxelChunk::ModifyTerrain(const FVector& LocalPosition, float Radius, floa
 
                     float DensityChange = Strength * Falloff;
 
-                    int32 Index = GetDensityIndex(X, Y, Z);
-                    if (Index >= 0 && Index < DensityData.Num())
+                    int32 Index = Data->GetDensityIndex(X, Y, Z);
+                    if (Data->DensityData.IsValidIndex(Index))
                     {
-                        if (bAdd)
-                            DensityData[Index] -= DensityChange;
-                        else
-                            DensityData[Index] += DensityChange;
-
-                        DensityData[Index] = FMath::Clamp(DensityData[Index], -1.0f, 1.0f);
+                        // Clamped to [-1, 1]; quantized formats move at least one code per step
+                        Data->DensityData.Add(Index, bAdd ? -DensityChange : DensityChange);
+                        Data->Edits.SetDensity(Data->ChunkSize, X, Y, Z, Data->DensityData.Get(Index));
                     }
                 }
             }
         }
     }
 
-    bNeedsMeshRebuild = true;
+    // Only the blocks around the brush need new bounds and filtered values
+    Data->DensityPyramid.UpdateRegion(Data->DensityData,
+        FIntVector(CenterX - VoxelRadius, CenterY - VoxelRadius, CenterZ - VoxelRadius),
+        FIntVector(CenterX + VoxelRadius, CenterY + VoxelRadius, CenterZ + VoxelRadius));
+
+    Data->bUnsavedEdits = true;
+    MarkDataChanged();
 }
 
 void AVoxelChunk::SetLOD(EVoxelLOD NewLOD)
@@ -419,6 +449,16 @@ void AVoxelChunk::SetLOD(EVoxelLOD NewLOD)
     }
 }
 
+void AVoxelChunk::SetTransitionMask(uint8 NewMask, uint8 NewLevels)
+{
+    if (TransitionMask != NewMask || TransitionLevels != NewLevels)
+    {
+        TransitionMask = NewMask;
+        TransitionLevels = NewLevels;
+        bNeedsMeshRebuild = true;
+    }
+}
+
 void AVoxelChunk::SetCollisionEnabled(bool bEnabled)
 {
     if (bCollisionEnabled != bEnabled)
@@ -439,31 +479,54 @@ void AVoxelChunk::SetCollisionEnabled(bool bEnabled)
     }
 }
 
+void AVoxelChunk::UpdateMeshCollision()
+{
+    FProcMeshSection* Section = MeshComponent ? MeshComponent->GetProcMeshSection(0) : nullptr;
+    if (!Section || Section->ProcVertexBuffer.Num() == 0 || Section->bEnableCollision == bCollisionEnabled)
+    {
+        return;
+    }
+
+    // Same vertices and triangles - only the collision flag changes, so the component just re-cooks
+    FProcMeshSection Updated = *Section;
+    Updated.bEnableCollision = bCollisionEnabled;
+    MeshComponent->SetProcMeshSection(0, Updated);
+}
+
 void AVoxelChunk::UnloadVoxelData()
 {
     if (!bHasVoxelData) return;
 
-    // Free memory
-    DensityData.Empty();
-    MaterialData.Empty();
+    const FVoxelChunkData* Data = GetData();
+    if (!Data)
+    {
+        return;
+    }
+
+    // The arrays are regenerated on reload - only the edit layer stays, compressed
+    // Built as a new entry rather than emptied in place, so a shared snapshot is never copied first
+    TSharedRef<FVoxelChunkData, ESPMode::ThreadSafe> ColdData = MakeShared<FVoxelChunkData, ESPMode::ThreadSafe>();
+    ColdData->ChunkCoord = Data->ChunkCoord;
+    ColdData->ChunkSize = Data->ChunkSize;
+    if (!ColdData->TakeEditsFrom(*Data) || !ColdData->Compress())
+    {
+        return;
+    }
+
+    const int32 NumEditBricks = Data->Edits.NumBricks();
+    ChunkStore->SetData(DataHandle, ColdData);
 
     bHasVoxelData = false;
 
-    UE_LOG(LogVoxelWorld, Verbose, TEXT("Unloaded voxel data for chunk %s"), *ChunkCoord.ToString());
+    UE_LOG(LogVoxelWorld, Verbose, TEXT("Unloaded voxel data for chunk %s (kept %d edit bricks, %d bytes)"), *ChunkCoord.ToString(),
+        NumEditBricks, ColdData->CompressedPayload.Num());
 }
 
 void AVoxelChunk::ReloadVoxelData()
 {
     if (bHasVoxelData) return;
 
-    // Re-allocate and regenerate
-    int32 ChunkSize = WorldSettings.ChunkSize;
-    int32 DensitySize = (ChunkSize + 1) * (ChunkSize + 1) * (ChunkSize + 1);
-    int32 MaterialSize = ChunkSize * ChunkSize * ChunkSize;
-
-    DensityData.SetNum(DensitySize);
-    MaterialData.SetNum(MaterialSize);
-
+    // Regeneration replaces the store entry's data with a fresh lattice and reapplies the edit layer
     bHasVoxelData = true;
     bIsGenerated = false;
 
@@ -475,8 +538,10 @@ int64 AVoxelChunk::GetMemoryUsage() const
 {
     int64 TotalBytes = 0;
 
-    TotalBytes += DensityData.GetAllocatedSize();
-    TotalBytes += MaterialData.GetAllocatedSize();
+    if (const FVoxelChunkData* Data = GetData())
+    {
+        TotalBytes += Data->GetAllocatedSize();
+    }
 
     // Estimate mesh memory (rough approximation)
     if (MeshComponent && MeshComponent->GetProcMeshSection(0))
@@ -489,10 +554,24 @@ int64 AVoxelChunk::GetMemoryUsage() const
     return TotalBytes;
 }
 
+int64 AVoxelChunk::GetDensityMemorySaved() const
+{
+    const FVoxelChunkData* Data = GetData();
+    if (!Data)
+    {
+        return 0;
+    }
+
+    const int32 BytesPerValue = FVoxelDensityStorage::GetBytesPerValue(Data->DensityData.GetFormat());
+    return static_cast<int64>(Data->DensityData.Num()) * (sizeof(float) - BytesPerValue);
+}
+
 void AVoxelChunk::CompactMemory()
 {
-    DensityData.Shrink();
-    MaterialData.Shrink();
+    if (FVoxelChunkData* Data = GetMutableData())
+    {
+        Data->Shrink();
+    }
 }
 
 FColor AVoxelChunk::GetVoxelColor(EVoxelType Type) const
@@ -543,33 +622,109 @@ void AVoxelChunk::BuildMeshWithLOD(EVoxelLOD LODLevel)
         return;
     }
 
+    const FVoxelChunkData* Data = GetData();
+    if (!Data || !Data->HasData())
+    {
+        UE_LOG(LogVoxelWorld, Warning, TEXT("Chunk %s: Cannot build mesh - no voxel data in the store!"), *ChunkCoord.ToString());
+        return;
+    }
+
+    const int32 DataStep = Data->DataStep;
     FVoxelMeshData MeshData;
 
-    // Get step size for LOD
-    int32 StepSize = FVoxelLODSettings::GetStepSizeForLOD(LODLevel);
+    // Get step size for LOD, relative to the stored lattice
+    int32 StepSize = FVoxelMarchingCubes::GetLatticeStepSize(FVoxelLODSettings::GetStepSizeForLOD(LODLevel), DataStep, Data->GetDataCellsPerAxis());
 
-    // Create lambda functions for neighbor access
-    auto GetNeighborDensity = [this](int32 X, int32 Y, int32 Z) -> float
+    // Reduced-resolution data meshes as a smaller chunk of larger voxels
+    TUniquePtr<FVoxelMarchingCubes> ReducedMesher;
+    FVoxelMarchingCubes* Mesher = MarchingCubes.Get();
+    if (DataStep > 1)
     {
-        return GetDensityIncludingNeighbors(X, Y, Z);
-    };
+        ReducedMesher = MakeUnique<FVoxelMarchingCubes>(Data->GetDataCellsPerAxis(), WorldSettings.VoxelSize * DataStep);
+        Mesher = ReducedMesher.Get();
+    }
 
-    auto GetNeighborMaterial = [this](int32 X, int32 Y, int32 Z) -> EVoxelType
-    {
-        return GetMaterialIncludingNeighbors(X, Y, Z);
-    };
+    // Generate mesh with LOD - the padded density grid already holds everything the kernel reads
+    TArray<float> PaddedDensity;
+    Data->DensityData.Decode(PaddedDensity);
+
+    TArray<EVoxelType> Materials;
+    Data->MaterialData.Decode(Materials);
 
-    // Generate mesh with LOD
-    MarchingCubes->GenerateMeshLOD(
-        DensityData,
-        MaterialData,
-        GetNeighborDensity,
-        GetNeighborMaterial,
+    Mesher->GenerateMeshLOD(
+        PaddedDensity,
+        Materials,
         MeshData,
         StepSize,
-        WorldSettings.bDeduplicateVertices
+        WorldSettings.bDeduplicateVertices,
+        TransitionMask,
+        TransitionLevels,
+        &Data->DensityPyramid
     );
 
+    // A synchronous build supersedes any task still in flight
+    MeshTaskId = 0;
+
+    ApplyMeshData(MeshData, LODLevel);
+
+    bNeedsMeshRebuild = false;
+    CurrentLOD = LODLevel;
+}
+
+TSharedRef<FVoxelMeshingJob, ESPMode::ThreadSafe> AVoxelChunk::CreateMeshingJob(uint32 TaskId)
+{
+    TSharedRef<FVoxelMeshingJob, ESPMode::ThreadSafe> Job = MakeShared<FVoxelMeshingJob, ESPMode::ThreadSafe>();
+
+    Job->ChunkCoord = ChunkCoord;
+    Job->TaskId = TaskId;
+    Job->DataRevision = DataRevision.Load();
+    Job->ChunkSize = WorldSettings.ChunkSize;
+    Job->VoxelSize = WorldSettings.VoxelSize;
+    Job->LODLevel = CurrentLOD;
+    Job->bDeduplicateVertices = WorldSettings.bDeduplicateVertices;
+    Job->TransitionMask = TransitionMask;
+    Job->TransitionLevels = TransitionLevels;
+
+    // Shared snapshot of the store entry - no copy unless this chunk is edited while the job runs
+    Job->Data = ChunkStore ? ChunkStore->Snapshot(DataHandle) : nullptr;
+
+    MeshTaskId = TaskId;
+    bNeedsMeshRebuild = false;
+
+    return Job;
+}
+
+bool AVoxelChunk::ApplyMeshingJob(FVoxelMeshingJob& Job)
+{
+    // Superseded by a newer task, a synchronous build or pooling
+    if (Job.TaskId != MeshTaskId)
+    {
+        return false;
+    }
+
+    MeshTaskId = 0;
+
+    if (bPendingKill || !bIsGenerated)
+    {
+        return false;
+    }
+
+    // Data changed while the worker was meshing - the result no longer matches
+    if (Job.DataRevision != DataRevision.Load())
+    {
+        bNeedsMeshRebuild = true;
+        return false;
+    }
+
+    ApplyMeshData(Job.MeshData, Job.LODLevel);
+
+    UE_LOG(LogVoxelWorld, Verbose, TEXT("Async mesh for chunk %s built in %.2f ms"), *ChunkCoord.ToString(), Job.BuildTimeMs);
+
+    return true;
+}
+
+void AVoxelChunk::ApplyMeshData(FVoxelMeshData& MeshData, EVoxelLOD LODLevel)
+{
     // Clear existing mesh
     MeshComponent->ClearAllMeshSections();
 
@@ -602,9 +757,7 @@ void AVoxelChunk::BuildMeshWithLOD(EVoxelLOD LODLevel)
         }
     }
 
-    bNeedsMeshRebuild = false;
     ChunkState = EChunkState::Meshed;
-    CurrentLOD = LODLevel;
 
     UE_LOG(LogVoxelWorld, Verbose, TEXT("Built mesh for chunk %s (LOD%d): %d vertices, %d triangles, collision=%s"),
         *ChunkCoord.ToString(),
@@ -0,0 +1,616 @@
+// Copyright Your Company. All Rights Reserved.
+
+#include "VoxelChunkStore.h"
+#include "VoxelTerrainGenerator.h"
+#include "VoxelRegionStore.h"
+#include "VoxelWorldModule.h"
+#include "Misc/Compression.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+// ==========================================
+// Chunk Data - Generation
+// ==========================================
+
+bool FVoxelChunkData::Generate(const UVoxelTerrainGenerator& Generator, const FChunkCoord& InChunkCoord, int32 InChunkSize, int32 Step,
+    EVoxelDensityFormat DensityFormat, const TAtomic<bool>* bCancelled)
+{
+    ChunkCoord = InChunkCoord;
+    ChunkSize = InChunkSize;
+
+    // Single fused pass: density and material share the column stage and per-voxel cave results
+    // The apron is generated too, so meshing never has to reach into neighbours or the generator
+    const int32 EffectiveStep = Edits.IsEmpty() ? UVoxelTerrainGenerator::GetEffectiveDataStep(Step, ChunkSize) : 1;
+    TArray<float> GeneratedDensity;
+    TArray<EVoxelType> GeneratedMaterials;
+    if (!Generator.GenerateChunkData(ChunkCoord.X * ChunkSize, ChunkCoord.Y * ChunkSize, ChunkCoord.Z * ChunkSize, ChunkSize,
+        GeneratedDensity, GeneratedMaterials, bCancelled, FVoxelMarchingCubes::DensityApron, EffectiveStep))
+    {
+        return false;
+    }
+
+    DataStep = EffectiveStep;
+    DensityData.Encode(GeneratedDensity, DensityFormat);
+    MaterialData.Encode(GeneratedMaterials);
+    if (!Edits.Apply(ChunkSize, DensityData, MaterialData))
+    {
+        UE_LOG(LogVoxelWorld, Warning, TEXT("Chunk %s: Edit layer does not match chunk size %d - generating without it"), *ChunkCoord.ToString(), ChunkSize);
+        Edits.Empty();
+    }
+    DensityPyramid.Build(DensityData, GetDataCellsPerAxis());
+
+    return true;
+}
+
+int32 FVoxelChunkData::GetTargetDataStep(const FVoxelWorldSettings& Settings, EVoxelLOD LOD)
+{
+    if (!Settings.bReducedResolutionGeneration)
+    {
+        return 1;
+    }
+
+    return UVoxelTerrainGenerator::GetEffectiveDataStep(FVoxelLODSettings::GetStepSizeForLOD(LOD), Settings.ChunkSize);
+}
+
+// ==========================================
+// Chunk Data - Queries
+// ==========================================
+
+float FVoxelChunkData::GetDensity(int32 LocalX, int32 LocalY, int32 LocalZ) const
+{
+    const int32 Min = -FVoxelMarchingCubes::DensityApron;
+    const int32 Max = ChunkSize + FVoxelMarchingCubes::DensityApron;
+    if (LocalX < Min || LocalX > Max || LocalY < Min || LocalY > Max || LocalZ < Min || LocalZ > Max)
+    {
+        return 1.0f;
+    }
+
+    if (DataStep > 1)
+    {
+        return SampleReducedDensity(LocalX, LocalY, LocalZ);
+    }
+
+    const int32 Index = GetDensityIndex(LocalX, LocalY, LocalZ);
+    return DensityData.IsValidIndex(Index) ? DensityData.Get(Index) : 1.0f;
+}
+
+float FVoxelChunkData::SampleReducedDensity(int32 LocalX, int32 LocalY, int32 LocalZ) const
+{
+    const int32 Step = DataStep;
+
+    // Lattice cell and fraction - the apron keeps the upper neighbour of every padded coordinate inside the grid
+    auto Split = [Step](int32 Local, int32& OutCell, float& OutFrac)
+    {
+        OutCell = FMath::FloorToInt(static_cast<float>(Local) / Step);
+        OutFrac = static_cast<float>(Local - OutCell * Step) / Step;
+    };
+
+    auto At = [this](int32 X, int32 Y, int32 Z)
+    {
+        const int32 Index = GetDensityIndex(X, Y, Z);
+        return DensityData.IsValidIndex(Index) ? DensityData.Get(Index) : 1.0f;
+    };
+
+    int32 CX, CY, CZ;
+    float FX, FY, FZ;
+    Split(LocalX, CX, FX);
+    Split(LocalY, CY, FY);
+    Split(LocalZ, CZ, FZ);
+
+    const float D00 = FMath::Lerp(At(CX, CY, CZ), At(CX + 1, CY, CZ), FX);
+    const float D10 = FMath::Lerp(At(CX, CY + 1, CZ), At(CX + 1, CY + 1, CZ), FX);
+    const float D01 = FMath::Lerp(At(CX, CY, CZ + 1), At(CX + 1, CY, CZ + 1), FX);
+    const float D11 = FMath::Lerp(At(CX, CY + 1, CZ + 1), At(CX + 1, CY + 1, CZ + 1), FX);
+
+    return FMath::Lerp(FMath::Lerp(D00, D10, FY), FMath::Lerp(D01, D11, FY), FZ);
+}
+
+EVoxelType FVoxelChunkData::GetMaterial(int32 LocalX, int32 LocalY, int32 LocalZ) const
+{
+    if (LocalX < 0 || LocalX >= ChunkSize || LocalY < 0 || LocalY >= ChunkSize || LocalZ < 0 || LocalZ >= ChunkSize)
+    {
+        return EVoxelType::Air;
+    }
+
+    // Reduced-resolution chunks hold one material per lattice cell
+    const int32 Index = GetMaterialIndex(LocalX / DataStep, LocalY / DataStep, LocalZ / DataStep);
+    return MaterialData.IsValidIndex(Index) ? MaterialData.Get(Index) : EVoxelType::Air;
+}
+
+bool FVoxelChunkData::FindAirBlock(int32 LocalX, int32 LocalY, int32 LocalZ, FIntVector& OutBlockMin, int32& OutBlockSize) const
+{
+    if (!DensityPyramid.IsBuilt() || LocalX < 0 || LocalX >= ChunkSize || LocalY < 0 || LocalY >= ChunkSize || LocalZ < 0 || LocalZ >= ChunkSize)
+    {
+        return false;
+    }
+
+    const FIntVector Cell(LocalX / DataStep, LocalY / DataStep, LocalZ / DataStep);
+
+    // Coarsest first - positive density everywhere in a block means air or water, never a solid voxel
+    for (int32 Level = DensityPyramid.GetNumLevels(); Level >= 1; --Level)
+    {
+        const FIntVector Block(Cell.X >> Level, Cell.Y >> Level, Cell.Z >> Level);
+
+        float Min, Max;
+        DensityPyramid.GetBlockBounds(Level, Block.X, Block.Y, Block.Z, Min, Max);
+
+        if (Min > 0.0f)
+        {
+            OutBlockSize = (1 << Level) * DataStep;
+            OutBlockMin = Block * OutBlockSize;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool FVoxelChunkData::GetHomogeneousFill(FVoxelHomogeneousChunk& OutFill) const
+{
+    // Coarse lattices can miss thin features, and edited data cannot be regenerated on promotion
+    if (HasEdits() || DataStep != 1 || !DensityPyramid.IsBuilt())
+    {
+        return false;
+    }
+
+    // Coarsest block bounds cover every lattice point the mesher reads for this chunk's own cells
+    const int32 Level = DensityPyramid.GetNumLevels();
+    const int32 Blocks = DensityPyramid.GetBlocksPerAxis(Level);
+
+    float ChunkMin = MAX_flt;
+    float ChunkMax = -MAX_flt;
+    for (int32 BZ = 0; BZ < Blocks; ++BZ)
+    {
+        for (int32 BY = 0; BY < Blocks; ++BY)
+        {
+            for (int32 BX = 0; BX < Blocks; ++BX)
+            {
+                float Min, Max;
+                DensityPyramid.GetBlockBounds(Level, BX, BY, BZ, Min, Max);
+                ChunkMin = FMath::Min(ChunkMin, Min);
+                ChunkMax = FMath::Max(ChunkMax, Max);
+            }
+        }
+    }
+
+    if (ChunkMin >= 0.0f)
+    {
+        OutFill = FVoxelHomogeneousChunk(EVoxelChunkContent::Empty, EVoxelType::Air);
+        return true;
+    }
+
+    if (ChunkMax < 0.0f)
+    {
+        OutFill = FVoxelHomogeneousChunk(EVoxelChunkContent::Solid, MaterialData.GetDominantMaterial());
+        return true;
+    }
+
+    return false;
+}
+
+// ==========================================
+// Chunk Data - Updates
+// ==========================================
+
+bool FVoxelChunkData::CopyApronFrom(const FVoxelChunkData& Source)
+{
+    if (&Source == this || !HasData() || !Source.HasData())
+    {
+        return false;
+    }
+
+    // A coarser source holds nothing but unedited generated data, which our own lattice already has exactly
+    if (Source.DataStep > DataStep)
+    {
+        return false;
+    }
+
+    const int32 Apron = FVoxelMarchingCubes::DensityApron;
+    const int32 Cells = GetDataCellsPerAxis();
+
+    // Source origin in our local coordinates (chunk sizes are multiples of every data step)
+    const FIntVector Offset(
+        (Source.ChunkCoord.X - ChunkCoord.X) * ChunkSize,
+        (Source.ChunkCoord.Y - ChunkCoord.Y) * ChunkSize,
+        (Source.ChunkCoord.Z - ChunkCoord.Z) * ChunkSize
+    );
+
+    // Overlap of our padded lattice with the voxels the source owns, in our lattice coordinates
+    const FIntVector Min(
+        FMath::Max(-Apron, Offset.X / DataStep),
+        FMath::Max(-Apron, Offset.Y / DataStep),
+        FMath::Max(-Apron, Offset.Z / DataStep)
+    );
+    const FIntVector Max(
+        FMath::Min(Cells + Apron, (Offset.X + ChunkSize) / DataStep - 1),
+        FMath::Min(Cells + Apron, (Offset.Y + ChunkSize) / DataStep - 1),
+        FMath::Min(Cells + Apron, (Offset.Z + ChunkSize) / DataStep - 1)
+    );
+
+    // Our lattice points are a subset of a finer (or equal) source lattice
+    const int32 Ratio = DataStep / Source.DataStep;
+
+    bool bChanged = false;
+    FIntVector ChangedMin(MAX_int32);
+    FIntVector ChangedMax(MIN_int32);
+    for (int32 Z = Min.Z; Z <= Max.Z; ++Z)
+    {
+        for (int32 Y = Min.Y; Y <= Max.Y; ++Y)
+        {
+            for (int32 X = Min.X; X <= Max.X; ++X)
+            {
+                const int32 SourceIndex = Source.GetDensityIndex(
+                    X * Ratio - Offset.X / Source.DataStep,
+                    Y * Ratio - Offset.Y / Source.DataStep,
+                    Z * Ratio - Offset.Z / Source.DataStep);
+                const float SourceDensity = Source.DensityData.Get(SourceIndex);
+                const int32 Index = GetDensityIndex(X, Y, Z);
+                if (DensityData.Get(Index) != SourceDensity)
+                {
+                    DensityData.Set(Index, SourceDensity);
+                    bChanged = true;
+                    ChangedMin = FIntVector(FMath::Min(ChangedMin.X, X), FMath::Min(ChangedMin.Y, Y), FMath::Min(ChangedMin.Z, Z));
+                    ChangedMax = FIntVector(FMath::Max(ChangedMax.X, X), FMath::Max(ChangedMax.Y, Y), FMath::Max(ChangedMax.Z, Z));
+                }
+            }
+        }
+    }
+
+    if (bChanged)
+    {
+        DensityPyramid.UpdateRegion(DensityData, ChangedMin, ChangedMax);
+    }
+
+    return bChanged;
+}
+
+void FVoxelChunkData::Empty()
+{
+    DensityData.Empty();
+    MaterialData.Empty();
+    DensityPyramid.Reset();
+    Edits.Empty();
+    CompressedPayload.Empty();
+    UncompressedPayloadSize = 0;
+}
+
+void FVoxelChunkData::Shrink()
+{
+    DensityData.Shrink();
+    MaterialData.Shrink();
+}
+
+SIZE_T FVoxelChunkData::GetAllocatedSize() const
+{
+    return DensityData.GetAllocatedSize() + MaterialData.GetAllocatedSize() + DensityPyramid.GetAllocatedSize() +
+        Edits.GetAllocatedSize() + CompressedPayload.GetAllocatedSize();
+}
+
+// ==========================================
+// Chunk Data - Cold Tier
+// ==========================================
+
+bool FVoxelChunkData::Compress()
+{
+    // The arrays are a pure function of the generator and the edit layer - only the layer is worth keeping
+    if (!Edits.IsEmpty())
+    {
+        TArray<uint8> Compressed;
+        int32 RawSize = 0;
+        if (!GetCompressedEdits(Compressed, RawSize))
+        {
+            return false;
+        }
+
+        CompressedPayload = MoveTemp(Compressed);
+        UncompressedPayloadSize = RawSize;
+        Edits.Empty();
+    }
+
+    DensityData.Empty();
+    MaterialData.Empty();
+    DensityPyramid.Reset();
+
+    return true;
+}
+
+bool FVoxelChunkData::TakeEditsFrom(const FVoxelChunkData& Previous)
+{
+    bUnsavedEdits = Previous.bUnsavedEdits;
+
+    if (!Previous.IsCompressed())
+    {
+        Edits = Previous.Edits;
+        return true;
+    }
+
+    return DecompressEdits(Previous.CompressedPayload.GetData(), Previous.CompressedPayload.Num(), Previous.UncompressedPayloadSize, Edits);
+}
+
+bool FVoxelChunkData::GetCompressedEdits(TArray<uint8>& OutPayload, int32& OutUncompressedSize) const
+{
+    if (IsCompressed())
+    {
+        OutPayload = CompressedPayload;
+        OutUncompressedSize = UncompressedPayloadSize;
+        return true;
+    }
+
+    OutPayload.Reset();
+    OutUncompressedSize = 0;
+    if (Edits.IsEmpty())
+    {
+        return true;
+    }
+
+    TArray<uint8> Raw;
+    FMemoryWriter Writer(Raw);
+
+    // Serialize only reads the layer when saving
+    const_cast<FVoxelEditLayer&>(Edits).Serialize(Writer);
+
+    // LZ4 - decompression is what stands between a cold chunk and an edit, so it wins over ratio
+    int32 CompressedSize = FCompression::CompressMemoryBound(NAME_LZ4, Raw.Num());
+    OutPayload.SetNumUninitialized(CompressedSize);
+    if (!FCompression::CompressMemory(NAME_LZ4, OutPayload.GetData(), CompressedSize, Raw.GetData(), Raw.Num()))
+    {
+        OutPayload.Reset();
+        return false;
+    }
+
+    OutPayload.SetNum(CompressedSize, EAllowShrinking::Yes);
+    OutUncompressedSize = Raw.Num();
+    return true;
+}
+
+bool FVoxelChunkData::DecompressEdits(const uint8* Payload, int32 PayloadSize, int32 UncompressedSize, FVoxelEditLayer& OutEdits)
+{
+    if (UncompressedSize <= 0)
+    {
+        return false;
+    }
+
+    TArray<uint8> Raw;
+    Raw.SetNumUninitialized(UncompressedSize);
+    if (!FCompression::UncompressMemory(NAME_LZ4, Raw.GetData(), Raw.Num(), Payload, PayloadSize))
+    {
+        return false;
+    }
+
+    FMemoryReader Reader(Raw);
+    OutEdits.Serialize(Reader);
+
+    return !Reader.IsError();
+}
+
+// ==========================================
+// Chunk Store
+// ==========================================
+
+FVoxelChunkHandle FVoxelChunkStore::FindOrAdd(const FChunkCoord& Coord)
+{
+    const FVoxelChunkHandle Existing = Find(Coord);
+    if (Existing.IsSet())
+    {
+        return Existing;
+    }
+
+    // Grow at 3/4 load (tombstones count - they lengthen probes just like live keys)
+    if ((NumEntries + NumTombstones + 1) * 4 > Buckets.Num() * 3)
+    {
+        Rehash(FMath::Max(64, static_cast<int32>(FMath::RoundUpToPowerOfTwo((NumEntries + 1) * 2))));
+    }
+
+    int32 SlotIndex;
+    if (FreeSlots.Num() > 0)
+    {
+        SlotIndex = FreeSlots.Pop(EAllowShrinking::No);
+    }
+    else
+    {
+        SlotIndex = Slots.AddDefaulted();
+    }
+
+    FSlot& Slot = Slots[SlotIndex];
+    Slot.Data = MakeShared<FVoxelChunkData, ESPMode::ThreadSafe>();
+    Slot.Data->ChunkCoord = Coord;
+
+    // First empty or tombstoned bucket on the probe path
+    const uint64 Key = PackCoord(Coord);
+    const int32 Mask = Buckets.Num() - 1;
+    for (int32 Bucket = HashKey(Key) & Mask;; Bucket = (Bucket + 1) & Mask)
+    {
+        if (Buckets[Bucket].Slot < 0)
+        {
+            if (Buckets[Bucket].Slot == TombstoneBucket)
+            {
+                --NumTombstones;
+            }
+            Buckets[Bucket].Key = Key;
+            Buckets[Bucket].Slot = SlotIndex;
+            break;
+        }
+    }
+
+    ++NumEntries;
+
+    FVoxelChunkHandle Handle;
+    Handle.Index = SlotIndex;
+    Handle.Serial = Slot.Serial;
+    return Handle;
+}
+
+FVoxelChunkHandle FVoxelChunkStore::Find(const FChunkCoord& Coord) const
+{
+    FVoxelChunkHandle Handle;
+
+    const int32 Bucket = FindBucket(PackCoord(Coord));
+    if (Bucket != INDEX_NONE)
+    {
+        Handle.Index = Buckets[Bucket].Slot;
+        Handle.Serial = Slots[Handle.Index].Serial;
+    }
+
+    return Handle;
+}
+
+int32 FVoxelChunkStore::FindBucket(uint64 Key) const
+{
+    if (NumEntries == 0)
+    {
+        return INDEX_NONE;
+    }
+
+    const int32 Mask = Buckets.Num() - 1;
+    for (int32 Bucket = HashKey(Key) & Mask;; Bucket = (Bucket + 1) & Mask)
+    {
+        const FBucket& Entry = Buckets[Bucket];
+        if (Entry.Slot == EmptyBucket)
+        {
+            return INDEX_NONE;
+        }
+        if (Entry.Slot >= 0 && Entry.Key == Key)
+        {
+            return Bucket;
+        }
+    }
+}
+
+bool FVoxelChunkStore::Remove(const FChunkCoord& Coord)
+{
+    const int32 Bucket = FindBucket(PackCoord(Coord));
+    if (Bucket == INDEX_NONE)
+    {
+        return false;
+    }
+
+    const int32 SlotIndex = Buckets[Bucket].Slot;
+    Buckets[Bucket].Slot = TombstoneBucket;
+    ++NumTombstones;
+    --NumEntries;
+
+    FSlot& Slot = Slots[SlotIndex];
+    Slot.Data.Reset();
+    ++Slot.Serial;
+    FreeSlots.Add(SlotIndex);
+
+    return true;
+}
+
+void FVoxelChunkStore::Empty()
+{
+    Slots.Empty();
+    FreeSlots.Empty();
+    Buckets.Empty();
+    NumEntries = 0;
+    NumTombstones = 0;
+}
+
+void FVoxelChunkStore::Rehash(int32 NewNumBuckets)
+{
+    TArray<FBucket> OldBuckets = MoveTemp(Buckets);
+
+    Buckets.Init(FBucket(), NewNumBuckets);
+    NumTombstones = 0;
+
+    const int32 Mask = NewNumBuckets - 1;
+    for (const FBucket& Old : OldBuckets)
+    {
+        if (Old.Slot < 0)
+        {
+            continue;
+        }
+
+        int32 Bucket = HashKey(Old.Key) & Mask;
+        while (Buckets[Bucket].Slot != EmptyBucket)
+        {
+            Bucket = (Bucket + 1) & Mask;
+        }
+        Buckets[Bucket] = Old;
+    }
+}
+
+FVoxelChunkData* FVoxelChunkStore::GetMutable(const FVoxelChunkHandle& Handle)
+{
+    if (!IsValid(Handle))
+    {
+        return nullptr;
+    }
+
+    // Copy on write - a snapshot (an in-flight mesh build) keeps reading the data it was given
+    TSharedPtr<FVoxelChunkData, ESPMode::ThreadSafe>& Data = Slots[Handle.Index].Data;
+    if (!Data.IsUnique())
+    {
+        Data = MakeShared<FVoxelChunkData, ESPMode::ThreadSafe>(*Data);
+    }
+
+    return Data.Get();
+}
+
+FVoxelChunkDataSnapshot FVoxelChunkStore::Snapshot(const FVoxelChunkHandle& Handle) const
+{
+    return IsValid(Handle) ? FVoxelChunkDataSnapshot(Slots[Handle.Index].Data) : FVoxelChunkDataSnapshot();
+}
+
+void FVoxelChunkStore::SetData(const FVoxelChunkHandle& Handle, const TSharedRef<FVoxelChunkData, ESPMode::ThreadSafe>& NewData)
+{
+    if (IsValid(Handle))
+    {
+        Slots[Handle.Index].Data = NewData;
+    }
+}
+
+SIZE_T FVoxelChunkStore::GetAllocatedSize() const
+{
+    SIZE_T Bytes = Slots.GetAllocatedSize() + FreeSlots.GetAllocatedSize() + Buckets.GetAllocatedSize();
+
+    for (const FSlot& Slot : Slots)
+    {
+        if (Slot.Data.IsValid())
+        {
+            Bytes += sizeof(FVoxelChunkData) + Slot.Data->GetAllocatedSize();
+        }
+    }
+
+    return Bytes;
+}
+
+// ==========================================
+// Generation Job
+// ==========================================
+
+void FVoxelGenerationJob::Execute()
+{
+    const double StartTime = FPlatformTime::Seconds();
+
+    if (bCancelled)
+    {
+        return;
+    }
+
+    if (!Generator)
+    {
+        return;
+    }
+
+    TSharedRef<FVoxelChunkData, ESPMode::ThreadSafe> Data = MakeShared<FVoxelChunkData, ESPMode::ThreadSafe>();
+    if (Source.IsValid() && !Data->TakeEditsFrom(*Source))
+    {
+        UE_LOG(LogVoxelWorld, Warning, TEXT("Chunk %s: Could not restore edit layer"), *ChunkCoord.ToString());
+        return;
+    }
+
+    // Persisted edits go in ahead of generation, so the baseline is built once with them applied
+    if (!Source.IsValid() && RegionStore.IsValid() && !RegionStore->LoadEdits(ChunkCoord, Data->Edits))
+    {
+        UE_LOG(LogVoxelWorld, Warning, TEXT("Chunk %s: Could not load saved edits - generating without them"), *ChunkCoord.ToString());
+        Data->Edits.Empty();
+    }
+
+    if (Data->Generate(*Generator, ChunkCoord, ChunkSize, DataStep, DensityFormat, &bCancelled))
+    {
+        Result = Data;
+    }
+
+    BuildTimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+}
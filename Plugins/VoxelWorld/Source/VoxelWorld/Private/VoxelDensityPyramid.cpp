@@ -0,0 +1,229 @@
+// Copyright Your Company. All Rights Reserved.
+
+#include "VoxelDensityPyramid.h"
+#include "VoxelMarchingCubes.h"
+
+// ==========================================
+// Build / Update
+// ==========================================
+
+void FVoxelDensityPyramid::Build(const FVoxelDensityStorage& PaddedDensity, int32 InCellsPerAxis)
+{
+    CellsPerAxis = InCellsPerAxis;
+    PaddedSize = FVoxelMarchingCubes::GetPaddedDensitySize(CellsPerAxis);
+
+    if (CellsPerAxis < 2 || PaddedDensity.Num() != PaddedSize * PaddedSize * PaddedSize)
+    {
+        Reset();
+        return;
+    }
+
+    // Halve while the cells divide evenly - a power-of-two chunk goes all the way down to a single block
+    NumLevels = FMath::CountTrailingZeros(static_cast<uint32>(CellsPerAxis));
+
+    MinLevels.SetNum(NumLevels);
+    MaxLevels.SetNum(NumLevels);
+    AveragedLevels.SetNum(NumLevels);
+
+    for (int32 Level = 1; Level <= NumLevels; ++Level)
+    {
+        const int32 Blocks = GetBlocksPerAxis(Level);
+        const int32 Points = Blocks + 1;
+
+        MinLevels[Level - 1].SetNumUninitialized(Blocks * Blocks * Blocks);
+        MaxLevels[Level - 1].SetNumUninitialized(Blocks * Blocks * Blocks);
+        AveragedLevels[Level - 1].SetNumUninitialized(Points * Points * Points);
+    }
+
+    UpdateRegion(PaddedDensity, FIntVector(0), FIntVector(CellsPerAxis));
+}
+
+void FVoxelDensityPyramid::UpdateRegion(const FVoxelDensityStorage& PaddedDensity, const FIntVector& Min, const FIntVector& Max)
+{
+    if (!IsBuilt() || PaddedDensity.Num() != PaddedSize * PaddedSize * PaddedSize)
+    {
+        return;
+    }
+
+    // Apron points feed neither the bounds nor the filter
+    FIntVector PointMin(FMath::Max(Min.X, 0), FMath::Max(Min.Y, 0), FMath::Max(Min.Z, 0));
+    FIntVector PointMax(FMath::Min(Max.X, CellsPerAxis), FMath::Min(Max.Y, CellsPerAxis), FMath::Min(Max.Z, CellsPerAxis));
+
+    if (PointMin.X > PointMax.X || PointMin.Y > PointMax.Y || PointMin.Z > PointMax.Z)
+    {
+        return;
+    }
+
+    const FIntVector RawMin = PointMin;
+    const FIntVector RawMax = PointMax;
+
+    for (int32 Level = 1; Level <= NumLevels; ++Level)
+    {
+        const int32 BlockCells = 1 << Level;
+        const int32 LastBlock = GetBlocksPerAxis(Level) - 1;
+
+        // Blocks whose inclusive corners touch a changed raw point
+        auto FirstBlock = [BlockCells](int32 Point) { return FMath::Max((Point + BlockCells - 1) / BlockCells - 1, 0); };
+        const FIntVector BlockMin(FirstBlock(RawMin.X), FirstBlock(RawMin.Y), FirstBlock(RawMin.Z));
+        const FIntVector BlockMax(
+            FMath::Min(RawMax.X / BlockCells, LastBlock),
+            FMath::Min(RawMax.Y / BlockCells, LastBlock),
+            FMath::Min(RawMax.Z / BlockCells, LastBlock)
+        );
+        UpdateBounds(PaddedDensity, Level, BlockMin, BlockMax);
+
+        // Filtered points whose tent footprint (one point either side on the level below) touches a changed point
+        const int32 LastPoint = GetBlocksPerAxis(Level);
+        PointMin = FIntVector(FMath::Max((PointMin.X - 1) / 2, 0), FMath::Max((PointMin.Y - 1) / 2, 0), FMath::Max((PointMin.Z - 1) / 2, 0));
+        PointMax = FIntVector(FMath::Min((PointMax.X + 2) / 2, LastPoint), FMath::Min((PointMax.Y + 2) / 2, LastPoint), FMath::Min((PointMax.Z + 2) / 2, LastPoint));
+        UpdateAverages(PaddedDensity, Level, PointMin, PointMax);
+    }
+}
+
+void FVoxelDensityPyramid::Reset()
+{
+    CellsPerAxis = 0;
+    PaddedSize = 0;
+    NumLevels = 0;
+
+    MinLevels.Empty();
+    MaxLevels.Empty();
+    AveragedLevels.Empty();
+}
+
+SIZE_T FVoxelDensityPyramid::GetAllocatedSize() const
+{
+    SIZE_T Bytes = MinLevels.GetAllocatedSize() + MaxLevels.GetAllocatedSize() + AveragedLevels.GetAllocatedSize();
+
+    for (int32 i = 0; i < NumLevels; ++i)
+    {
+        Bytes += MinLevels[i].GetAllocatedSize() + MaxLevels[i].GetAllocatedSize() + AveragedLevels[i].GetAllocatedSize();
+    }
+
+    return Bytes;
+}
+
+// ==========================================
+// Level Evaluation
+// ==========================================
+
+float FVoxelDensityPyramid::GetRaw(const FVoxelDensityStorage& Density, int32 X, int32 Y, int32 Z) const
+{
+    const int32 Apron = FVoxelMarchingCubes::DensityApron;
+    return Density.Get((X + Apron) + (Y + Apron) * PaddedSize + (Z + Apron) * PaddedSize * PaddedSize);
+}
+
+float FVoxelDensityPyramid::GetLevelPoint(const FVoxelDensityStorage& Density, int32 Level, int32 X, int32 Y, int32 Z) const
+{
+    if (Level == 0)
+    {
+        return GetRaw(Density, X, Y, Z);
+    }
+
+    const int32 Points = GetBlocksPerAxis(Level) + 1;
+    return AveragedLevels[Level - 1][X + Y * Points + Z * Points * Points];
+}
+
+void FVoxelDensityPyramid::UpdateBounds(const FVoxelDensityStorage& Density, int32 Level, const FIntVector& BlockMin, const FIntVector& BlockMax)
+{
+    const int32 Blocks = GetBlocksPerAxis(Level);
+    TArray<float>& Mins = MinLevels[Level - 1];
+    TArray<float>& Maxs = MaxLevels[Level - 1];
+
+    for (int32 BZ = BlockMin.Z; BZ <= BlockMax.Z; ++BZ)
+    {
+        for (int32 BY = BlockMin.Y; BY <= BlockMax.Y; ++BY)
+        {
+            for (int32 BX = BlockMin.X; BX <= BlockMax.X; ++BX)
+            {
+                float BlockMinValue = MAX_flt;
+                float BlockMaxValue = -MAX_flt;
+
+                if (Level == 1)
+                {
+                    // 3x3x3 raw points - the block's two cells per axis plus their shared far corners
+                    for (int32 Z = BZ * 2; Z <= BZ * 2 + 2; ++Z)
+                    {
+                        for (int32 Y = BY * 2; Y <= BY * 2 + 2; ++Y)
+                        {
+                            for (int32 X = BX * 2; X <= BX * 2 + 2; ++X)
+                            {
+                                const float Value = GetRaw(Density, X, Y, Z);
+                                BlockMinValue = FMath::Min(BlockMinValue, Value);
+                                BlockMaxValue = FMath::Max(BlockMaxValue, Value);
+                            }
+                        }
+                    }
+                }
+                else
+                {
+                    // Union of the eight child blocks
+                    const int32 ChildBlocks = GetBlocksPerAxis(Level - 1);
+                    const TArray<float>& ChildMins = MinLevels[Level - 2];
+                    const TArray<float>& ChildMaxs = MaxLevels[Level - 2];
+
+                    for (int32 Child = 0; Child < 8; ++Child)
+                    {
+                        const int32 CX = BX * 2 + (Child & 1);
+                        const int32 CY = BY * 2 + ((Child >> 1) & 1);
+                        const int32 CZ = BZ * 2 + ((Child >> 2) & 1);
+                        const int32 ChildIndex = CX + CY * ChildBlocks + CZ * ChildBlocks * ChildBlocks;
+
+                        BlockMinValue = FMath::Min(BlockMinValue, ChildMins[ChildIndex]);
+                        BlockMaxValue = FMath::Max(BlockMaxValue, ChildMaxs[ChildIndex]);
+                    }
+                }
+
+                const int32 Index = BX + BY * Blocks + BZ * Blocks * Blocks;
+                Mins[Index] = BlockMinValue;
+                Maxs[Index] = BlockMaxValue;
+            }
+        }
+    }
+}
+
+void FVoxelDensityPyramid::UpdateAverages(const FVoxelDensityStorage& Density, int32 Level, const FIntVector& PointMin, const FIntVector& PointMax)
+{
+    const int32 LastPoint = GetBlocksPerAxis(Level);
+    const int32 Points = LastPoint + 1;
+    TArray<float>& Averages = AveragedLevels[Level - 1];
+
+    static const float TentWeights[3] = { 0.25f, 0.5f, 0.25f };
+
+    for (int32 Z = PointMin.Z; Z <= PointMax.Z; ++Z)
+    {
+        for (int32 Y = PointMin.Y; Y <= PointMax.Y; ++Y)
+        {
+            for (int32 X = PointMin.X; X <= PointMax.X; ++X)
+            {
+                float Value;
+
+                const bool bOnFace = X == 0 || Y == 0 || Z == 0 || X == LastPoint || Y == LastPoint || Z == LastPoint;
+                if (bOnFace)
+                {
+                    // Shared with the neighbour - keep the exact lattice value so both sides mesh the same face
+                    Value = GetRaw(Density, X << Level, Y << Level, Z << Level);
+                }
+                else
+                {
+                    // Separable [1 2 1] / 4 tent over the level below - the footprint never leaves the chunk
+                    Value = 0.0f;
+                    for (int32 DZ = -1; DZ <= 1; ++DZ)
+                    {
+                        for (int32 DY = -1; DY <= 1; ++DY)
+                        {
+                            const float WeightYZ = TentWeights[DY + 1] * TentWeights[DZ + 1];
+                            for (int32 DX = -1; DX <= 1; ++DX)
+                            {
+                                Value += WeightYZ * TentWeights[DX + 1] *
+                                    GetLevelPoint(Density, Level - 1, X * 2 + DX, Y * 2 + DY, Z * 2 + DZ);
+                            }
+                        }
+                    }
+                }
+
+                Averages[X + Y * Points + Z * Points * Points] = Value;
+            }
+        }
+    }
+}
@@ -0,0 +1,105 @@
+// Copyright Your Company. All Rights Reserved.
+
+#include "VoxelDensityStorage.h"
+#include "Math/VectorRegister.h"
+
+int32 FVoxelDensityStorage::GetBytesPerValue(EVoxelDensityFormat InFormat)
+{
+    switch (InFormat)
+    {
+    case EVoxelDensityFormat::SNorm16:  return 2;
+    case EVoxelDensityFormat::SNorm8:   return 1;
+    default:                            return 4;
+    }
+}
+
+void FVoxelDensityStorage::Encode(const TArray<float>& Source, EVoxelDensityFormat InFormat)
+{
+    Format = InFormat;
+    NumValues = Source.Num();
+    Bytes.SetNumUninitialized(NumValues * GetBytesPerValue(InFormat));
+
+    if (Format == EVoxelDensityFormat::Float32)
+    {
+        FMemory::Memcpy(Bytes.GetData(), Source.GetData(), NumValues * sizeof(float));
+        return;
+    }
+
+    for (int32 i = 0; i < NumValues; ++i)
+    {
+        Set(i, Source[i]);
+    }
+}
+
+void FVoxelDensityStorage::Decode(TArray<float>& Out) const
+{
+    Out.SetNumUninitialized(NumValues);
+    float* Dest = Out.GetData();
+
+    int32 i = 0;
+    switch (Format)
+    {
+    case EVoxelDensityFormat::SNorm16:
+    {
+        // Four signed 16-bit codes per load, normalized by 1/32767
+        const int16* Codes = reinterpret_cast<const int16*>(Bytes.GetData());
+        for (; i + 4 <= NumValues; i += 4)
+        {
+            VectorStore(VectorLoadSRGBA16N(Codes + i), Dest + i);
+        }
+        for (; i < NumValues; ++i)
+        {
+            Dest[i] = Get(i);
+        }
+        break;
+    }
+
+    case EVoxelDensityFormat::SNorm8:
+    {
+        // Four signed bytes per load, scaled by the same 1/127 constant Get uses
+        const int8* Codes = reinterpret_cast<const int8*>(Bytes.GetData());
+        const VectorRegister4Float Scale = VectorSetFloat1(1.0f / 127.0f);
+        for (; i + 4 <= NumValues; i += 4)
+        {
+            VectorStore(VectorMultiply(VectorLoadSignedByte4(Codes + i), Scale), Dest + i);
+        }
+        for (; i < NumValues; ++i)
+        {
+            Dest[i] = Get(i);
+        }
+        break;
+    }
+
+    default:
+        FMemory::Memcpy(Dest, Bytes.GetData(), NumValues * sizeof(float));
+        break;
+    }
+}
+
+void FVoxelDensityStorage::Add(int32 Index, float Delta)
+{
+    const float Current = Get(Index);
+    float Target = FMath::Clamp(Current + Delta, -1.0f, 1.0f);
+
+    if (Format != EVoxelDensityFormat::Float32 && Delta != 0.0f)
+    {
+        const int32 Scale = Format == EVoxelDensityFormat::SNorm16 ? 32767 : 127;
+        const int32 CurrentCode = ToCode(Current, Scale);
+        const int32 TargetCode = ToCode(Target, Scale);
+
+        // Rounded back onto the starting code - step one code in the edit's direction instead
+        if (TargetCode == CurrentCode)
+        {
+            const int32 NudgedCode = FMath::Clamp(CurrentCode + (Delta > 0.0f ? 1 : -1), -Scale, Scale);
+            Target = static_cast<float>(NudgedCode) / Scale;
+        }
+    }
+
+    Set(Index, Target);
+}
+
+void FVoxelDensityStorage::Empty()
+{
+    NumValues = 0;
+    Bytes.Empty();
+}
@@ -231,7 +231,8 @@ TArray<AVoxelChunk*> UVoxelDiggingTool::GetAffectedChunks(const FVector& WorldPo
         {
             for (int32 Z = MinChunk.Z; Z <= MaxChunk.Z; ++Z)
             {
-                AVoxelChunk* Chunk = VoxelWorldManager->GetChunk(FChunkCoord(X, Y, Z));
+                // Chunks skipped as all-air/all-solid are spawned on demand so they can be edited
+                AVoxelChunk* Chunk = VoxelWorldManager->GetOrMaterializeChunk(FChunkCoord(X, Y, Z));
                 if (Chunk && Chunk->IsGenerated() && Chunk->HasVoxelData())
                 {
                     AffectedChunks.Add(Chunk);
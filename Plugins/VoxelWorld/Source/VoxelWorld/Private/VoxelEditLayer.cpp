@@ -0,0 +1,215 @@
+// Copyright Your Company. All Rights Reserved.
+
+#include "VoxelEditLayer.h"
+#include "VoxelDensityStorage.h"
+#include "VoxelMaterialStorage.h"
+#include "VoxelMarchingCubes.h"
+
+int32 FVoxelEditLayer::GetBricksPerAxis(int32 ChunkSize)
+{
+    return FMath::DivideAndRoundUp(FVoxelMarchingCubes::GetPaddedDensitySize(ChunkSize), BrickSize);
+}
+
+int64 FVoxelEditLayer::GetMaxSerializedSize(int32 ChunkSize)
+{
+    const int64 NumCells = FMath::Cube<int64>(GetBricksPerAxis(ChunkSize));
+    const int64 BrickBytes = sizeof(int32) + sizeof(FBrick::DensityMask) + sizeof(FBrick::MaterialMask) + BrickVolume * (sizeof(float) + sizeof(EVoxelType));
+    return 2 * sizeof(int32) + NumCells * BrickBytes;
+}
+
+FVoxelEditLayer::FBrick* FVoxelEditLayer::FindOrAddBrick(int32 ChunkSize, int32 LocalX, int32 LocalY, int32 LocalZ, int32& OutPoint)
+{
+    // Bricks are laid over padded coordinates, so the apron shares the same grid
+    const int32 Apron = FVoxelMarchingCubes::DensityApron;
+    const int32 PaddedSize = FVoxelMarchingCubes::GetPaddedDensitySize(ChunkSize);
+    const FIntVector Padded(LocalX + Apron, LocalY + Apron, LocalZ + Apron);
+
+    if (Padded.X < 0 || Padded.Y < 0 || Padded.Z < 0 || Padded.X >= PaddedSize || Padded.Y >= PaddedSize || Padded.Z >= PaddedSize)
+    {
+        return nullptr;
+    }
+
+    if (BrickLookup.Num() == 0)
+    {
+        BricksPerAxis = GetBricksPerAxis(ChunkSize);
+        BrickLookup.Init(INDEX_NONE, BricksPerAxis * BricksPerAxis * BricksPerAxis);
+    }
+
+    const int32 BrickIndex = (Padded.X / BrickSize) + (Padded.Y / BrickSize) * BricksPerAxis + (Padded.Z / BrickSize) * BricksPerAxis * BricksPerAxis;
+    int16& Slot = BrickLookup[BrickIndex];
+    if (Slot == INDEX_NONE)
+    {
+        Slot = static_cast<int16>(Bricks.AddDefaulted());
+        Bricks[Slot].BrickIndex = BrickIndex;
+    }
+
+    OutPoint = (Padded.X % BrickSize) + (Padded.Y % BrickSize) * BrickSize + (Padded.Z % BrickSize) * BrickSize * BrickSize;
+    return &Bricks[Slot];
+}
+
+void FVoxelEditLayer::SetDensity(int32 ChunkSize, int32 LocalX, int32 LocalY, int32 LocalZ, float Density)
+{
+    int32 Point;
+    if (FBrick* Brick = FindOrAddBrick(ChunkSize, LocalX, LocalY, LocalZ, Point))
+    {
+        Brick->Density[Point] = Density;
+        Brick->DensityMask[Point >> 6] |= 1ull << (Point & 63);
+    }
+}
+
+void FVoxelEditLayer::SetMaterial(int32 ChunkSize, int32 LocalX, int32 LocalY, int32 LocalZ, EVoxelType Material)
+{
+    if (LocalX < 0 || LocalY < 0 || LocalZ < 0 || LocalX >= ChunkSize || LocalY >= ChunkSize || LocalZ >= ChunkSize)
+    {
+        return;
+    }
+
+    int32 Point;
+    if (FBrick* Brick = FindOrAddBrick(ChunkSize, LocalX, LocalY, LocalZ, Point))
+    {
+        Brick->Material[Point] = Material;
+        Brick->MaterialMask[Point >> 6] |= 1ull << (Point & 63);
+    }
+}
+
+bool FVoxelEditLayer::Apply(int32 ChunkSize, FVoxelDensityStorage& DensityData, FVoxelMaterialStorage& MaterialData) const
+{
+    if (IsEmpty())
+    {
+        return true;
+    }
+
+    const int32 Apron = FVoxelMarchingCubes::DensityApron;
+    const int32 PaddedSize = FVoxelMarchingCubes::GetPaddedDensitySize(ChunkSize);
+
+    // Full-resolution data only - the layer was recorded on the full lattice
+    if (DensityData.Num() != PaddedSize * PaddedSize * PaddedSize || MaterialData.Num() != ChunkSize * ChunkSize * ChunkSize)
+    {
+        return true;
+    }
+
+    // A loaded layer carries its own grid - saved under another chunk size, its indices mean nothing here
+    if (BricksPerAxis != GetBricksPerAxis(ChunkSize))
+    {
+        return false;
+    }
+
+    const int32 NumCells = BricksPerAxis * BricksPerAxis * BricksPerAxis;
+    for (const FBrick& Brick : Bricks)
+    {
+        if (Brick.BrickIndex < 0 || Brick.BrickIndex >= NumCells)
+        {
+            continue;
+        }
+
+        const FIntVector Origin(
+            (Brick.BrickIndex % BricksPerAxis) * BrickSize,
+            ((Brick.BrickIndex / BricksPerAxis) % BricksPerAxis) * BrickSize,
+            (Brick.BrickIndex / (BricksPerAxis * BricksPerAxis)) * BrickSize
+        );
+
+        // Walk set bits only - a typical brush stroke touches a small fraction of each brick
+        for (int32 Word = 0; Word < BrickVolume / 64; ++Word)
+        {
+            for (uint64 Bits = Brick.DensityMask[Word]; Bits; Bits &= Bits - 1)
+            {
+                const int32 Point = Word * 64 + FMath::CountTrailingZeros64(Bits);
+                const FIntVector Padded = Origin + FIntVector(Point % BrickSize, (Point / BrickSize) % BrickSize, Point / (BrickSize * BrickSize));
+
+                // Edge bricks overhang the padded lattice - only a corrupt mask sets bits there
+                if (Padded.X >= PaddedSize || Padded.Y >= PaddedSize || Padded.Z >= PaddedSize)
+                {
+                    continue;
+                }
+                DensityData.Set(Padded.X + Padded.Y * PaddedSize + Padded.Z * PaddedSize * PaddedSize, Brick.Density[Point]);
+            }
+
+            for (uint64 Bits = Brick.MaterialMask[Word]; Bits; Bits &= Bits - 1)
+            {
+                const int32 Point = Word * 64 + FMath::CountTrailingZeros64(Bits);
+                const FIntVector Local = Origin + FIntVector(Point % BrickSize, (Point / BrickSize) % BrickSize, Point / (BrickSize * BrickSize)) - FIntVector(Apron);
+                if (Local.X < 0 || Local.Y < 0 || Local.Z < 0 || Local.X >= ChunkSize || Local.Y >= ChunkSize || Local.Z >= ChunkSize)
+                {
+                    continue;
+                }
+                MaterialData.Set(Local.X + Local.Y * ChunkSize + Local.Z * ChunkSize * ChunkSize, Brick.Material[Point]);
+            }
+        }
+    }
+
+    return true;
+}
+
+void FVoxelEditLayer::Empty()
+{
+    Bricks.Empty();
+    BrickLookup.Empty();
+    BricksPerAxis = 0;
+}
+
+void FVoxelEditLayer::Serialize(FArchive& Ar)
+{
+    int32 NumBricks = Bricks.Num();
+    Ar << BricksPerAxis;
+    Ar << NumBricks;
+
+    if (Ar.IsLoading())
+    {
+        Empty();
+
+        const int32 NumCells = BricksPerAxis * BricksPerAxis * BricksPerAxis;
+        if (BricksPerAxis < 0 || NumBricks < 0 || NumBricks > NumCells || NumCells > MAX_int16)
+        {
+            Ar.SetError();
+            Empty();
+            return;
+        }
+
+        if (NumBricks > 0)
+        {
+            BrickLookup.Init(INDEX_NONE, NumCells);
+            Bricks.SetNum(NumBricks);
+        }
+        else
+        {
+            BricksPerAxis = 0;
+        }
+    }
+
+    for (int32 Slot = 0; Slot < NumBricks && !Ar.IsError(); ++Slot)
+    {
+        FBrick& Brick = Bricks[Slot];
+        Ar << Brick.BrickIndex;
+        Ar.Serialize(Brick.DensityMask, sizeof(Brick.DensityMask));
+        Ar.Serialize(Brick.MaterialMask, sizeof(Brick.MaterialMask));
+
+        if (Ar.IsLoading())
+        {
+            if (!BrickLookup.IsValidIndex(Brick.BrickIndex) || BrickLookup[Brick.BrickIndex] != INDEX_NONE)
+            {
+                Ar.SetError();
+                break;
+            }
+            BrickLookup[Brick.BrickIndex] = static_cast<int16>(Slot);
+        }
+
+        // Only overridden values are stored, in mask order
+        for (int32 Word = 0; Word < BrickVolume / 64; ++Word)
+        {
+            for (uint64 Bits = Brick.DensityMask[Word]; Bits; Bits &= Bits - 1)
+            {
+                Ar << Brick.Density[Word * 64 + FMath::CountTrailingZeros64(Bits)];
+            }
+
+            for (uint64 Bits = Brick.MaterialMask[Word]; Bits; Bits &= Bits - 1)
+            {
+                Ar << Brick.Material[Word * 64 + FMath::CountTrailingZeros64(Bits)];
+            }
+        }
+    }
+
+    if (Ar.IsLoading() && Ar.IsError())
+    {
+        Empty();
+    }
+}
@@ -2,6 +2,7 @@
 
 #include "VoxelMarchingCubes.h"
 #include "VoxelChunk.h"
+#include "VoxelChunkStore.h"
 
 // Corner offsets for the 8 vertices of a cube
 const FIntVector FVoxelMarchingCubes::CornerOffsets[8] = {
@@ -22,6 +23,13 @@ const int32 FVoxelMarchingCubes::EdgeConnections[12][2] = {
     {0, 4}, {1, 5}, {2, 6}, {3, 7}   // Vertical edges
 };
 
+// Edge owners - each edge belongs to the lattice point at its minimum corner, along one axis
+const int32 FVoxelMarchingCubes::EdgeOwners[12][4] = {
+    {0, 0, 0, 0}, {1, 0, 0, 1}, {0, 1, 0, 0}, {0, 0, 0, 1},  // Bottom face edges
+    {0, 0, 1, 0}, {1, 0, 1, 1}, {0, 1, 1, 0}, {0, 0, 1, 1},  // Top face edges
+    {0, 0, 0, 2}, {1, 0, 0, 2}, {1, 1, 0, 2}, {0, 1, 0, 2}   // Vertical edges
+};
+
 // Edge table - for each of the 256 possible configurations, which edges are intersected
 const int32 FVoxelMarchingCubes::EdgeTable[256] = {
     0x0  , 0x109, 0x203, 0x30a, 0x406, 0x50f, 0x605, 0x70c,
@@ -321,6 +329,7 @@ const int32 FVoxelMarchingCubes::TriangleTable[256][16] = {
 
 FVoxelMarchingCubes::FVoxelMarchingCubes(int32 InChunkSize, float InVoxelSize, float InSurfaceLevel)
     : ChunkSize(InChunkSize)
+    , PaddedSize(GetPaddedDensitySize(InChunkSize))
     , VoxelSize(InVoxelSize)
     , SurfaceLevel(InSurfaceLevel)
 {
@@ -345,161 +354,223 @@ FColor FVoxelMarchingCubes::GetVoxelColor(EVoxelType Type) const
     }
 }
 
-float FVoxelMarchingCubes::GetDensity(
-    const TArray<float>& DensityData,
-    TFunction<float(int32, int32, int32)> GetNeighborDensity,
-    int32 X, int32 Y, int32 Z
-) const
-{
-    // Check if within chunk bounds (density grid is ChunkSize+1)
-    if (X >= 0 && X <= ChunkSize && Y >= 0 && Y <= ChunkSize && Z >= 0 && Z <= ChunkSize)
-    {
-        int32 Index = GetIndex(X, Y, Z);
-        if (Index >= 0 && Index < DensityData.Num())
-        {
-            return DensityData[Index];
-        }
-    }
-
-    // Get from neighbor
-    return GetNeighborDensity(X, Y, Z);
-}
-
-FVector FVoxelMarchingCubes::InterpolateVertex(
+void FVoxelMarchingCubes::InterpolateVertex(
     const FVector& P1, const FVector& P2,
-    float D1, float D2
+    const FVector& G1, const FVector& G2,
+    float D1, float D2,
+    FVector& OutPosition, FVector& OutGradient
 ) const
 {
     // If either point is exactly on the surface, return it
-    if (FMath::Abs(D1 - SurfaceLevel) < SMALL_NUMBER)
-        return P1;
+    if (FMath::Abs(D1 - SurfaceLevel) < SMALL_NUMBER || FMath::Abs(D1 - D2) < SMALL_NUMBER)
+    {
+        OutPosition = P1;
+        OutGradient = G1;
+        return;
+    }
     if (FMath::Abs(D2 - SurfaceLevel) < SMALL_NUMBER)
-        return P2;
-    if (FMath::Abs(D1 - D2) < SMALL_NUMBER)
-        return P1;
+    {
+        OutPosition = P2;
+        OutGradient = G2;
+        return;
+    }
 
     // Linear interpolation to find surface crossing point
     float T = (SurfaceLevel - D1) / (D2 - D1);
     T = FMath::Clamp(T, 0.0f, 1.0f);
 
-    return P1 + T * (P2 - P1);
+    OutPosition = P1 + T * (P2 - P1);
+    OutGradient = G1 + T * (G2 - G1);
 }
 
-FVector FVoxelMarchingCubes::CalculateNormal(
-    const TArray<float>& DensityData,
-    TFunction<float(int32, int32, int32)> GetNeighborDensity,
-    int32 X, int32 Y, int32 Z,
-    int32 StepSize
-) const
+int32 FVoxelMarchingCubes::AddVertex(
+    FVoxelMeshData& OutMeshData,
+    const FVector& Position,
+    const FVector& Normal,
+    const FVector2D& UV,
+    const FColor& Color,
+    const FVector& Tangent
+)
 {
-    // Calculate gradient using central differences (scaled for LOD)
-    float GradX = GetDensity(DensityData, GetNeighborDensity, X + StepSize, Y, Z) -
-                  GetDensity(DensityData, GetNeighborDensity, X - StepSize, Y, Z);
-    float GradY = GetDensity(DensityData, GetNeighborDensity, X, Y + StepSize, Z) -
-                  GetDensity(DensityData, GetNeighborDensity, X, Y - StepSize, Z);
-    float GradZ = GetDensity(DensityData, GetNeighborDensity, X, Y, Z + StepSize) -
-                  GetDensity(DensityData, GetNeighborDensity, X, Y, Z - StepSize);
-
-    FVector Normal(-GradX, -GradY, -GradZ);
-    Normal.Normalize();
-
-    return Normal;
+    int32 NewIndex = OutMeshData.Vertices.Num();
+
+    OutMeshData.Vertices.Add(Position);
+    OutMeshData.Normals.Add(Normal);
+    OutMeshData.UVs.Add(UV);
+    OutMeshData.VertexColors.Add(Color);
+    OutMeshData.Tangents.Add(FProcMeshTangent(Tangent, false));
+
+    return NewIndex;
 }
 
-EVoxelType FVoxelMarchingCubes::GetDominantMaterial(
+void FVoxelMarchingCubes::GenerateMesh(
+    const TArray<float>& PaddedDensity,
     const TArray<EVoxelType>& MaterialData,
-    TFunction<EVoxelType(int32, int32, int32)> GetNeighborMaterial,
-    int32 X, int32 Y, int32 Z
-) const
+    FVoxelMeshData& OutMeshData
+)
 {
-    // Get material from the cell - use the voxel data array which is ChunkSize^3
-    if (X >= 0 && X < ChunkSize && Y >= 0 && Y < ChunkSize && Z >= 0 && Z < ChunkSize)
+    // Legacy method - calls LOD version with step size 1
+    GenerateMeshLOD(PaddedDensity, MaterialData, OutMeshData, 1, true);
+}
+
+void FVoxelMarchingCubes::AddTransitionSkirts(FVoxelMeshData& MeshData, uint8 TransitionMask, float SkirtDepth)
+{
+    const int32 NumSurfaceIndices = MeshData.Triangles.Num();
+    const float Tolerance = VoxelSize * 0.001f;
+
+    for (int32 Face = 0; Face < 6; ++Face)
     {
-        int32 Index = X + Y * ChunkSize + Z * ChunkSize * ChunkSize;
-        if (Index >= 0 && Index < MaterialData.Num())
+        if (!(TransitionMask & (1 << Face)))
         {
-            return MaterialData[Index];
+            continue;
         }
-    }
 
-    return GetNeighborMaterial(X, Y, Z);
-}
+        const int32 Axis = Face / 2;
+        const float Plane = (Face & 1) ? ChunkSize * VoxelSize : 0.0f;
 
-int32 FVoxelMarchingCubes::AddVertex(
-    FVoxelMeshData& OutMeshData,
-    const FVector& Position,
-    const FVector& Normal,
-    const FVector2D& UV,
-    const FColor& Color,
-    const FVector& Tangent,
-    bool bDeduplicate
-)
-{
-    if (bDeduplicate)
-    {
-        // Check if vertex already exists
-        uint64 Hash = HashPosition(Position);
-        int32* ExistingIndex = VertexMap.Find(Hash);
+        auto IsOnFace = [&](int32 Vertex)
+        {
+            return FMath::Abs(MeshData.Vertices[Vertex][Axis] - Plane) <= Tolerance;
+        };
 
-        if (ExistingIndex)
+        // One skirt vertex per contour vertex, so the skirt is as connected as the contour
+        TMap<int32, int32> SkirtVertices;
+        auto GetSkirtVertex = [&](int32 Vertex, const FVector& FallbackDirection)
         {
-            // Return existing vertex index
-            return *ExistingIndex;
-        }
+            if (const int32* Existing = SkirtVertices.Find(Vertex))
+            {
+                return *Existing;
+            }
 
-        // Add new vertex
-        int32 NewIndex = OutMeshData.Vertices.Num();
-        VertexMap.Add(Hash, NewIndex);
+            // Copied out first - AddVertex grows the arrays these live in
+            const FVector Position = MeshData.Vertices[Vertex];
+            const FVector Normal = MeshData.Normals[Vertex];
+            const FVector2D UV = MeshData.UVs[Vertex];
+            const FColor Color = MeshData.VertexColors[Vertex];
+            const FVector Tangent = MeshData.Tangents[Vertex].TangentX;
+
+            // Full depth however steeply the surface meets the face - a grazing surface leaves the widest crack
+            FVector Direction = -Normal;
+            Direction[Axis] = 0.0f;
+            if (!Direction.Normalize(UE_KINDA_SMALL_NUMBER))
+            {
+                Direction = FallbackDirection;
+            }
 
-        OutMeshData.Vertices.Add(Position);
-        OutMeshData.Normals.Add(Normal);
-        OutMeshData.UVs.Add(UV);
-        OutMeshData.VertexColors.Add(Color);
-        OutMeshData.Tangents.Add(FProcMeshTangent(Tangent, false));
+            const int32 SkirtVertex = AddVertex(MeshData, Position + Direction * SkirtDepth, Normal, UV, Color, Tangent);
+            SkirtVertices.Add(Vertex, SkirtVertex);
+            return SkirtVertex;
+        };
 
-        return NewIndex;
-    }
-    else
-    {
-        // No deduplication - just add vertex
-        int32 NewIndex = OutMeshData.Vertices.Num();
+        for (int32 i = 0; i < NumSurfaceIndices; i += 3)
+        {
+            const int32 Corners[3] = { MeshData.Triangles[i], MeshData.Triangles[i + 1], MeshData.Triangles[i + 2] };
+            const bool bOnFace[3] = { IsOnFace(Corners[0]), IsOnFace(Corners[1]), IsOnFace(Corners[2]) };
 
-        OutMeshData.Vertices.Add(Position);
-        OutMeshData.Normals.Add(Normal);
-        OutMeshData.UVs.Add(UV);
-        OutMeshData.VertexColors.Add(Color);
-        OutMeshData.Tangents.Add(FProcMeshTangent(Tangent, false));
+            // A triangle lying in the face plane has no contour edge of its own
+            if (bOnFace[0] && bOnFace[1] && bOnFace[2])
+            {
+                continue;
+            }
 
-        return NewIndex;
+            for (int32 Edge = 0; Edge < 3; ++Edge)
+            {
+                const int32 Next = (Edge + 1) % 3;
+                if (!bOnFace[Edge] || !bOnFace[Next])
+                {
+                    continue;
+                }
+
+                // The edge runs reversed in the skirt quad, so the skirt keeps the surface's winding
+                const int32 A = Corners[Edge];
+                const int32 B = Corners[Next];
+
+                // Surface lying along the face: hang the skirt across the edge instead, on the side away from the triangle
+                const FVector Along = MeshData.Vertices[B] - MeshData.Vertices[A];
+                FVector Across = FVector::ZeroVector;
+                Across[Axis] = 1.0f;
+                Across = FVector::CrossProduct(Across, Along).GetSafeNormal();
+                const FVector Inward = MeshData.Vertices[Corners[(Edge + 2) % 3]] - MeshData.Vertices[A];
+                if (FVector::DotProduct(Across, Inward) > 0.0f)
+                {
+                    Across = -Across;
+                }
+
+                const int32 SkirtA = GetSkirtVertex(A, Across);
+                const int32 SkirtB = GetSkirtVertex(B, Across);
+
+                MeshData.Triangles.Add(B);
+                MeshData.Triangles.Add(A);
+                MeshData.Triangles.Add(SkirtA);
+
+                MeshData.Triangles.Add(B);
+                MeshData.Triangles.Add(SkirtA);
+                MeshData.Triangles.Add(SkirtB);
+            }
+        }
     }
 }
 
-void FVoxelMarchingCubes::GenerateMesh(
-    const TArray<float>& DensityData,
-    const TArray<EVoxelType>& MaterialData,
-    TFunction<float(int32, int32, int32)> GetNeighborDensity,
-    TFunction<EVoxelType(int32, int32, int32)> GetNeighborMaterial,
-    FVoxelMeshData& OutMeshData
-)
+void FVoxelMarchingCubes::BuildSurfaceFreeBlocks(const FVoxelDensityPyramid& Pyramid, int32 SkipLevel, bool bFilteredCorners)
 {
-    // Legacy method - calls LOD version with step size 1
-    GenerateMeshLOD(DensityData, MaterialData, GetNeighborDensity, GetNeighborMaterial, OutMeshData, 1, true);
+    const int32 Blocks = Pyramid.GetBlocksPerAxis(SkipLevel);
+    SurfaceFreeBlocks.Init(false, Blocks * Blocks * Blocks);
+
+    // Filtered interior corners blend raw values up to one LOD cell away, which always lies in an adjacent block
+    const int32 Reach = bFilteredCorners ? 1 : 0;
+
+    for (int32 BZ = 0; BZ < Blocks; ++BZ)
+    {
+        for (int32 BY = 0; BY < Blocks; ++BY)
+        {
+            for (int32 BX = 0; BX < Blocks; ++BX)
+            {
+                bool bHasInside = false;
+                bool bHasOutside = false;
+
+                for (int32 NZ = FMath::Max(BZ - Reach, 0); NZ <= FMath::Min(BZ + Reach, Blocks - 1); ++NZ)
+                {
+                    for (int32 NY = FMath::Max(BY - Reach, 0); NY <= FMath::Min(BY + Reach, Blocks - 1); ++NY)
+                    {
+                        for (int32 NX = FMath::Max(BX - Reach, 0); NX <= FMath::Min(BX + Reach, Blocks - 1); ++NX)
+                        {
+                            float Min, Max;
+                            Pyramid.GetBlockBounds(SkipLevel, NX, NY, NZ, Min, Max);
+                            bHasInside |= Min < SurfaceLevel;
+                            bHasOutside |= Max >= SurfaceLevel;
+                        }
+                    }
+                }
+
+                SurfaceFreeBlocks[BX + BY * Blocks + BZ * Blocks * Blocks] = !(bHasInside && bHasOutside);
+            }
+        }
+    }
 }
 
 void FVoxelMarchingCubes::GenerateMeshLOD(
-    const TArray<float>& DensityData,
+    const TArray<float>& PaddedDensity,
     const TArray<EVoxelType>& MaterialData,
-    TFunction<float(int32, int32, int32)> GetNeighborDensity,
-    TFunction<EVoxelType(int32, int32, int32)> GetNeighborMaterial,
     FVoxelMeshData& OutMeshData,
     int32 StepSize,
-    bool bDeduplicateVertices
+    bool bDeduplicateVertices,
+    uint8 TransitionMask,
+    int32 TransitionLevels,
+    const FVoxelDensityPyramid* Pyramid
 )
 {
     OutMeshData.Reset();
 
-    // Clear vertex map for deduplication
-    VertexMap.Empty();
+    if (PaddedDensity.Num() != PaddedSize * PaddedSize * PaddedSize || MaterialData.Num() != ChunkSize * ChunkSize * ChunkSize)
+    {
+        return;
+    }
+
+    // Corners and gradients are read unchecked - a step that does not tile the chunk would run past the padded grid
+    check(StepSize >= 1 && ChunkSize % StepSize == 0);
+
+    const float* Density = PaddedDensity.GetData();
+    const EVoxelType* Materials = MaterialData.GetData();
 
     // Calculate effective voxel size for LOD
     float EffectiveVoxelSize = VoxelSize * StepSize;
@@ -509,25 +580,79 @@ void FVoxelMarchingCubes::GenerateMeshLOD(
     OutMeshData.Vertices.Reserve(EstimatedVerts);
     OutMeshData.Triangles.Reserve(EstimatedVerts * 3);
 
+    // Filtered corner values for coarse steps - the mip level whose point spacing equals the step
+    const int32 LODLevel = FMath::FloorLog2(StepSize);
+    const bool bUsePyramid = Pyramid && Pyramid->IsBuilt() && Pyramid->GetCellsPerAxis() == ChunkSize && (1 << LODLevel) == StepSize;
+    const float* Filtered = nullptr;
+    int32 FilteredPoints = 0;
+    if (bUsePyramid && LODLevel >= 1 && LODLevel <= Pyramid->GetNumLevels())
+    {
+        Filtered = Pyramid->GetAveragedLevel(LODLevel).GetData();
+        FilteredPoints = (ChunkSize >> LODLevel) + 1;
+    }
+
+    // Face corners keep the raw lattice values so seams with same-LOD neighbours still match
+    auto GetCornerDensity = [&](const FIntVector& Corner)
+    {
+        if (Filtered && Corner.X > 0 && Corner.Y > 0 && Corner.Z > 0 && Corner.X < ChunkSize && Corner.Y < ChunkSize && Corner.Z < ChunkSize)
+        {
+            return Filtered[(Corner.X >> LODLevel) + (Corner.Y >> LODLevel) * FilteredPoints + (Corner.Z >> LODLevel) * FilteredPoints * FilteredPoints];
+        }
+        return Density[GetIndex(Corner.X, Corner.Y, Corner.Z)];
+    };
+
+    // Empty-space skipping on blocks a few LOD cells wide
+    const int32 SkipLevel = bUsePyramid ? FMath::Min(LODLevel + 2, Pyramid->GetNumLevels()) : 0;
+    const bool bSkipBlocks = SkipLevel > LODLevel;
+    const int32 SkipBlocksPerAxis = bSkipBlocks ? Pyramid->GetBlocksPerAxis(SkipLevel) : 0;
+    if (bSkipBlocks)
+    {
+        BuildSurfaceFreeBlocks(*Pyramid, SkipLevel, Filtered != nullptr);
+    }
+
+    // Two-slice edge vertex cache over the LOD lattice - exact, since StepSize divides ChunkSize, so owning points stay in their row
+    const int32 PointsPerAxis = ChunkSize / StepSize + 1;
+    const int32 SliceSize = PointsPerAxis * PointsPerAxis * 3;
+    if (bDeduplicateVertices)
+    {
+        EdgeVertexCache.SetNumUninitialized(SliceSize * 2, EAllowShrinking::No);
+        FMemory::Memset(EdgeVertexCache.GetData(), 0xFF, SliceSize * 2 * sizeof(int32));
+    }
+
     // Process each cell in the chunk at the LOD step size
     for (int32 Z = 0; Z < ChunkSize; Z += StepSize)
     {
+        const int32 CellZ = Z / StepSize;
+
+        // The slice above this layer still holds the layer below's bottom edges - recycle it
+        if (bDeduplicateVertices && CellZ > 0)
+        {
+            FMemory::Memset(EdgeVertexCache.GetData() + ((CellZ + 1) & 1) * SliceSize, 0xFF, SliceSize * sizeof(int32));
+        }
+
         for (int32 Y = 0; Y < ChunkSize; Y += StepSize)
         {
             for (int32 X = 0; X < ChunkSize; X += StepSize)
             {
+                // Jump to the end of a block the pyramid proves empty (the vertex cache only needs Z order)
+                if (bSkipBlocks)
+                {
+                    const int32 BlockIndex = (X >> SkipLevel) + (Y >> SkipLevel) * SkipBlocksPerAxis + (Z >> SkipLevel) * SkipBlocksPerAxis * SkipBlocksPerAxis;
+                    if (SurfaceFreeBlocks[BlockIndex])
+                    {
+                        X = (((X >> SkipLevel) + 1) << SkipLevel) - StepSize;
+                        continue;
+                    }
+                }
+
                 // Get density values at the 8 corners of this cell
                 float Densities[8];
-                FVector Corners[8];
+                FIntVector CornerCoords[8];
 
                 for (int32 i = 0; i < 8; ++i)
                 {
-                    int32 CX = X + CornerOffsets[i].X * StepSize;
-                    int32 CY = Y + CornerOffsets[i].Y * StepSize;
-                    int32 CZ = Z + CornerOffsets[i].Z * StepSize;
-
-                    Densities[i] = GetDensity(DensityData, GetNeighborDensity, CX, CY, CZ);
-                    Corners[i] = FVector(CX, CY, CZ) * VoxelSize;
+                    CornerCoords[i] = FIntVector(X, Y, Z) + CornerOffsets[i] * StepSize;
+                    Densities[i] = GetCornerDensity(CornerCoords[i]);
                 }
 
                 // Determine cube configuration (which corners are inside the surface)
@@ -541,55 +666,63 @@ void FVoxelMarchingCubes::GenerateMeshLOD(
                 }
 
                 // Skip if entirely inside or outside
-                if (EdgeTable[CubeIndex] == 0)
+                const int32 EdgeMask = EdgeTable[CubeIndex];
+                if (EdgeMask == 0)
                 {
                     continue;
                 }
 
-                // Get material for this cell
-                EVoxelType CellMaterial = GetDominantMaterial(MaterialData, GetNeighborMaterial, X, Y, Z);
+                // Corner positions and gradients - the apron keeps boundary gradients identical to the neighbour's
+                FVector Corners[8];
+                FVector Gradients[8];
+                for (int32 i = 0; i < 8; ++i)
+                {
+                    Corners[i] = FVector(CornerCoords[i]) * VoxelSize;
+                    Gradients[i] = CalculateGradient(Density, CornerCoords[i].X, CornerCoords[i].Y, CornerCoords[i].Z);
+                }
+
+                // Get material for this cell (cells always lie inside the chunk's own material grid)
+                EVoxelType CellMaterial = Materials[X + Y * ChunkSize + Z * ChunkSize * ChunkSize];
                 FColor VertexColor = GetVoxelColor(CellMaterial);
 
                 // Find vertices where surface intersects cube edges
                 FVector EdgeVertices[12];
+                FVector EdgeGradients[12];
 
-                if (EdgeTable[CubeIndex] & 1)
-                    EdgeVertices[0] = InterpolateVertex(Corners[0], Corners[1], Densities[0], Densities[1]);
-                if (EdgeTable[CubeIndex] & 2)
-                    EdgeVertices[1] = InterpolateVertex(Corners[1], Corners[2], Densities[1], Densities[2]);
-                if (EdgeTable[CubeIndex] & 4)
-                    EdgeVertices[2] = InterpolateVertex(Corners[2], Corners[3], Densities[2], Densities[3]);
-                if (EdgeTable[CubeIndex] & 8)
-                    EdgeVertices[3] = InterpolateVertex(Corners[3], Corners[0], Densities[3], Densities[0]);
-                if (EdgeTable[CubeIndex] & 16)
-                    EdgeVertices[4] = InterpolateVertex(Corners[4], Corners[5], Densities[4], Densities[5]);
-                if (EdgeTable[CubeIndex] & 32)
-                    EdgeVertices[5] = InterpolateVertex(Corners[5], Corners[6], Densities[5], Densities[6]);
-                if (EdgeTable[CubeIndex] & 64)
-                    EdgeVertices[6] = InterpolateVertex(Corners[6], Corners[7], Densities[6], Densities[7]);
-                if (EdgeTable[CubeIndex] & 128)
-                    EdgeVertices[7] = InterpolateVertex(Corners[7], Corners[4], Densities[7], Densities[4]);
-                if (EdgeTable[CubeIndex] & 256)
-                    EdgeVertices[8] = InterpolateVertex(Corners[0], Corners[4], Densities[0], Densities[4]);
-                if (EdgeTable[CubeIndex] & 512)
-                    EdgeVertices[9] = InterpolateVertex(Corners[1], Corners[5], Densities[1], Densities[5]);
-                if (EdgeTable[CubeIndex] & 1024)
-                    EdgeVertices[10] = InterpolateVertex(Corners[2], Corners[6], Densities[2], Densities[6]);
-                if (EdgeTable[CubeIndex] & 2048)
-                    EdgeVertices[11] = InterpolateVertex(Corners[3], Corners[7], Densities[3], Densities[7]);
+                for (int32 Edge = 0; Edge < 12; ++Edge)
+                {
+                    if (EdgeMask & (1 << Edge))
+                    {
+                        const int32 A = EdgeConnections[Edge][0];
+                        const int32 B = EdgeConnections[Edge][1];
+                        InterpolateVertex(Corners[A], Corners[B], Gradients[A], Gradients[B], Densities[A], Densities[B],
+                            EdgeVertices[Edge], EdgeGradients[Edge]);
+                    }
+                }
 
                 // Generate triangles
                 for (int32 i = 0; TriangleTable[CubeIndex][i] != -1; i += 3)
                 {
-                    FVector V0 = EdgeVertices[TriangleTable[CubeIndex][i]];
-                    FVector V1 = EdgeVertices[TriangleTable[CubeIndex][i + 1]];
-                    FVector V2 = EdgeVertices[TriangleTable[CubeIndex][i + 2]];
+                    const int32 E0 = TriangleTable[CubeIndex][i];
+                    const int32 E1 = TriangleTable[CubeIndex][i + 1];
+                    const int32 E2 = TriangleTable[CubeIndex][i + 2];
 
-                    // Calculate face normal (negated for correct winding)
+                    FVector V0 = EdgeVertices[E0];
+                    FVector V1 = EdgeVertices[E1];
+                    FVector V2 = EdgeVertices[E2];
+
+                    // Calculate face normal (negated for correct winding) - drives the UV projection
                     FVector Edge1 = V1 - V0;
                     FVector Edge2 = V2 - V0;
                     FVector FaceNormal = -FVector::CrossProduct(Edge1, Edge2).GetSafeNormal();
 
+                    // Smooth vertex normals from the density gradient, falling back to the face normal in flat regions
+                    auto GetVertexNormal = [&FaceNormal](const FVector& Gradient)
+                    {
+                        const FVector Normal = Gradient.GetSafeNormal();
+                        return Normal.IsZero() ? FaceNormal : Normal;
+                    };
+
                     // Calculate UVs (triplanar-style)
                     FVector2D UV0, UV1, UV2;
                     if (FMath::Abs(FaceNormal.Z) > FMath::Abs(FaceNormal.X) &&
@@ -615,10 +748,31 @@ void FVoxelMarchingCubes::GenerateMeshLOD(
                     // Calculate tangent
                     FVector Tangent = Edge1.GetSafeNormal();
 
-                    // Add vertices with optional deduplication
-                    int32 Idx0 = AddVertex(OutMeshData, V0, FaceNormal, UV0, VertexColor, Tangent, bDeduplicateVertices);
-                    int32 Idx1 = AddVertex(OutMeshData, V1, FaceNormal, UV1, VertexColor, Tangent, bDeduplicateVertices);
-                    int32 Idx2 = AddVertex(OutMeshData, V2, FaceNormal, UV2, VertexColor, Tangent, bDeduplicateVertices);
+                    // Reuse the vertex already emitted on this lattice edge, if any
+                    auto GetEdgeVertex = [&](int32 Edge, const FVector& Position, const FVector2D& UV) -> int32
+                    {
+                        if (!bDeduplicateVertices)
+                        {
+                            return AddVertex(OutMeshData, Position, GetVertexNormal(EdgeGradients[Edge]), UV, VertexColor, Tangent);
+                        }
+
+                        const int32* Owner = EdgeOwners[Edge];
+                        const int32 PointX = X / StepSize + Owner[0];
+                        const int32 PointY = Y / StepSize + Owner[1];
+                        const int32 Slice = (CellZ + Owner[2]) & 1;
+                        checkSlow(PointX < PointsPerAxis && PointY < PointsPerAxis);
+
+                        int32& CachedIndex = EdgeVertexCache[Slice * SliceSize + (PointX + PointY * PointsPerAxis) * 3 + Owner[3]];
+                        if (CachedIndex < 0)
+                        {
+                            CachedIndex = AddVertex(OutMeshData, Position, GetVertexNormal(EdgeGradients[Edge]), UV, VertexColor, Tangent);
+                        }
+                        return CachedIndex;
+                    };
+
+                    int32 Idx0 = GetEdgeVertex(E0, V0, UV0);
+                    int32 Idx1 = GetEdgeVertex(E1, V1, UV1);
+                    int32 Idx2 = GetEdgeVertex(E2, V2, UV2);
 
                     // Add triangle indices
                     OutMeshData.Triangles.Add(Idx0);
@@ -629,9 +783,44 @@ void FVoxelMarchingCubes::GenerateMeshLOD(
         }
     }
 
-    // Clear vertex map to free memory
-    VertexMap.Empty();
+    if (TransitionMask != 0)
+    {
+        AddTransitionSkirts(OutMeshData, TransitionMask, EffectiveVoxelSize * (1 << TransitionLevels));
+    }
 
     // Shrink arrays to actual size
     OutMeshData.Shrink();
 }
+
+// ==========================================
+// Meshing Job
+// ==========================================
+
+void FVoxelMeshingJob::Execute()
+{
+    const double StartTime = FPlatformTime::Seconds();
+
+    if (!Data.IsValid())
+    {
+        return;
+    }
+
+    const int32 DataStep = Data->DataStep;
+
+    // Expand quantized densities once up front - the kernel reads each lattice point several times
+    TArray<float> Density;
+    Data->DensityData.Decode(Density);
+
+    TArray<EVoxelType> Materials;
+    Data->MaterialData.Decode(Materials);
+
+    FVoxelMarchingCubes Mesher(ChunkSize / DataStep, VoxelSize * DataStep);
+    Mesher.GenerateMeshLOD(Density, Materials, MeshData,
+        FVoxelMarchingCubes::GetLatticeStepSize(FVoxelLODSettings::GetStepSizeForLOD(LODLevel), DataStep, ChunkSize / DataStep), bDeduplicateVertices, TransitionMask,
+        TransitionLevels, &Data->DensityPyramid);
+
+    // Drop the share so the next edit to the entry does not have to copy it
+    Data.Reset();
+
+    BuildTimeMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+}
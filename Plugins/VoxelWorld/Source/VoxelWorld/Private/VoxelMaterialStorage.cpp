@@ -0,0 +1,197 @@
+// Copyright Your Company. All Rights Reserved.
+
+#include "VoxelMaterialStorage.h"
+
+int32 FVoxelMaterialStorage::GetBitsForPaletteSize(int32 PaletteSize)
+{
+    if (PaletteSize <= 1)  return 0;
+    if (PaletteSize <= 2)  return 1;
+    if (PaletteSize <= 4)  return 2;
+    if (PaletteSize <= 16) return 4;
+    return 8;
+}
+
+void FVoxelMaterialStorage::Encode(const TArray<EVoxelType>& Source)
+{
+    NumValues = Source.Num();
+    Palette.Reset();
+    Words.Reset();
+
+    // Palette index of every material seen so far, INDEX_NONE until first use
+    int16 Remap[256];
+    FMemory::Memset(Remap, 0xFF, sizeof(Remap));
+
+    for (const EVoxelType Value : Source)
+    {
+        int16& Code = Remap[static_cast<uint8>(Value)];
+        if (Code == INDEX_NONE)
+        {
+            Code = static_cast<int16>(Palette.Add(Value));
+        }
+    }
+
+    if (Palette.Num() == 0)
+    {
+        Palette.Add(EVoxelType::Air);
+    }
+
+    BitsPerValue = GetBitsForPaletteSize(Palette.Num());
+    if (BitsPerValue == 0)
+    {
+        return;
+    }
+
+    Words.SetNumZeroed(FMath::DivideAndRoundUp(NumValues * BitsPerValue, 32));
+    for (int32 i = 0; i < NumValues; ++i)
+    {
+        const int32 BitOffset = i * BitsPerValue;
+        Words[BitOffset >> 5] |= static_cast<uint32>(Remap[static_cast<uint8>(Source[i])]) << (BitOffset & 31);
+    }
+}
+
+void FVoxelMaterialStorage::Decode(TArray<EVoxelType>& Out) const
+{
+    Out.SetNumUninitialized(NumValues);
+    if (NumValues == 0)
+    {
+        return;
+    }
+
+    if (BitsPerValue == 0)
+    {
+        FMemory::Memset(Out.GetData(), static_cast<uint8>(Palette[0]), NumValues * sizeof(EVoxelType));
+        return;
+    }
+
+    // Whole words at a time - the values per word is a power of two, so only the last word is partial
+    EVoxelType* Dest = Out.GetData();
+    const EVoxelType* PaletteData = Palette.GetData();
+    const int32 ValuesPerWord = 32 / BitsPerValue;
+    const uint32 Mask = (1u << BitsPerValue) - 1;
+
+    int32 i = 0;
+    for (const uint32 PackedWord : Words)
+    {
+        uint32 Word = PackedWord;
+        const int32 End = FMath::Min(i + ValuesPerWord, NumValues);
+        for (; i < End; ++i)
+        {
+            Dest[i] = PaletteData[Word & Mask];
+            Word >>= BitsPerValue;
+        }
+    }
+}
+
+void FVoxelMaterialStorage::Set(int32 Index, EVoxelType Value)
+{
+    int32 Code = Palette.Find(Value);
+    if (Code == INDEX_NONE)
+    {
+        Code = Palette.Add(Value);
+
+        const int32 NeededBits = GetBitsForPaletteSize(Palette.Num());
+        if (NeededBits != BitsPerValue)
+        {
+            Repack(NeededBits);
+        }
+    }
+    else if (BitsPerValue == 0)
+    {
+        // Already the uniform value
+        return;
+    }
+
+    SetCode(Index, static_cast<uint32>(Code));
+}
+
+void FVoxelMaterialStorage::Repack(int32 NewBitsPerValue)
+{
+    const int32 OldBitsPerValue = BitsPerValue;
+    TArray<uint32> OldWords = MoveTemp(Words);
+
+    BitsPerValue = NewBitsPerValue;
+    Words.SetNumZeroed(FMath::DivideAndRoundUp(NumValues * BitsPerValue, 32));
+
+    // Uniform arrays were all palette entry 0, which the zeroed words already encode
+    if (OldBitsPerValue == 0)
+    {
+        return;
+    }
+
+    const uint32 OldMask = (1u << OldBitsPerValue) - 1;
+    for (int32 i = 0; i < NumValues; ++i)
+    {
+        const int32 OldOffset = i * OldBitsPerValue;
+        SetCode(i, (OldWords[OldOffset >> 5] >> (OldOffset & 31)) & OldMask);
+    }
+}
+
+EVoxelType FVoxelMaterialStorage::GetDominantMaterial(bool bIgnoreAir) const
+{
+    if (NumValues == 0)
+    {
+        return EVoxelType::Air;
+    }
+
+    // Count palette indices straight from the packed words
+    TArray<int32, TInlineAllocator<16>> Counts;
+    Counts.SetNumZeroed(Palette.Num());
+
+    if (BitsPerValue == 0)
+    {
+        Counts[0] = NumValues;
+    }
+    else
+    {
+        const int32 ValuesPerWord = 32 / BitsPerValue;
+        const uint32 Mask = (1u << BitsPerValue) - 1;
+
+        int32 i = 0;
+        for (const uint32 PackedWord : Words)
+        {
+            uint32 Word = PackedWord;
+            const int32 End = FMath::Min(i + ValuesPerWord, NumValues);
+            for (; i < End; ++i)
+            {
+                ++Counts[Word & Mask];
+                Word >>= BitsPerValue;
+            }
+        }
+    }
+
+    EVoxelType Dominant = EVoxelType::Air;
+    int32 BestCount = 0;
+    for (int32 Code = 0; Code < Palette.Num(); ++Code)
+    {
+        if ((bIgnoreAir && Palette[Code] == EVoxelType::Air) || Counts[Code] <= BestCount)
+        {
+            continue;
+        }
+
+        Dominant = Palette[Code];
+        BestCount = Counts[Code];
+    }
+
+    return Dominant;
+}
+
+void FVoxelMaterialStorage::Empty()
+{
+    NumValues = 0;
+    BitsPerValue = 0;
+    Palette.Empty();
+    Words.Empty();
+}
+
+void FVoxelMaterialStorage::Shrink()
+{
+    // Edits only ever grow the palette - re-encoding drops unused entries and may return to a narrower packing
+    if (BitsPerValue > 0)
+    {
+        TArray<EVoxelType> Values;
+        Decode(Values);
+        Encode(Values);
+    }
+
+    Words.Shrink();
+}
@@ -10,9 +10,13 @@ const FVector UVoxelNoiseGenerator::GradientVectors3D[16] = {
     FVector(1, 1, 0), FVector(-1, 1, 0), FVector(0, -1, 1), FVector(0, -1, -1)
 };
 
+// Per-component gradient tables for the vectorized path (same values as GradientVectors3D)
+static const float GradientX3D[16] = { 1, -1, 1, -1, 1, -1, 1, -1, 0, 0, 0, 0, 1, -1, 0, 0 };
+static const float GradientY3D[16] = { 1, 1, -1, -1, 0, 0, 0, 0, 1, -1, 1, -1, 1, 1, -1, -1 };
+static const float GradientZ3D[16] = { 0, 0, 0, 0, 1, 1, -1, -1, 1, 1, -1, -1, 0, 0, 1, -1 };
+
 UVoxelNoiseGenerator::UVoxelNoiseGenerator()
 {
-    Permutation.SetNum(512);
     Initialize(12345);
 }
 
@@ -92,6 +96,28 @@ float UVoxelNoiseGenerator::GetNoise2D(float X, float Y) const
 }
 
 float UVoxelNoiseGenerator::GetNoise3D(float X, float Y, float Z) const
+{
+    const float Result = NoiseType == EVoxelNoiseType::Simplex
+        ? SimplexNoise3D(X, Y, Z, nullptr)
+        : PerlinNoise3D(X, Y, Z, nullptr);
+
+    // Normalize to [0, 1]
+    return (Result + 1.0f) * 0.5f;
+}
+
+float UVoxelNoiseGenerator::GetNoise3DWithGradient(float X, float Y, float Z, FVector& OutGradient) const
+{
+    FVector3f Gradient;
+    const float Result = NoiseType == EVoxelNoiseType::Simplex
+        ? SimplexNoise3D(X, Y, Z, &Gradient)
+        : PerlinNoise3D(X, Y, Z, &Gradient);
+
+    // Normalization to [0, 1] halves the gradient
+    OutGradient = FVector(Gradient * 0.5f);
+    return (Result + 1.0f) * 0.5f;
+}
+
+float UVoxelNoiseGenerator::PerlinNoise3D(float X, float Y, float Z, FVector3f* OutGradient) const
 {
     // Find grid cell
     int32 X0 = FMath::FloorToInt(X) & 255;
@@ -119,27 +145,146 @@ float UVoxelNoiseGenerator::GetNoise3D(float X, float Y, float Z) const
     int32 BA = Permutation[B] + Z0;
     int32 BB = Permutation[B + 1] + Z0;
     
+    // Corner gradient contributions
+    float G000 = Gradient3D(Permutation[AA], XF, YF, ZF);
+    float G100 = Gradient3D(Permutation[BA], XF - 1, YF, ZF);
+    float G010 = Gradient3D(Permutation[AB], XF, YF - 1, ZF);
+    float G110 = Gradient3D(Permutation[BB], XF - 1, YF - 1, ZF);
+    float G001 = Gradient3D(Permutation[AA + 1], XF, YF, ZF - 1);
+    float G101 = Gradient3D(Permutation[BA + 1], XF - 1, YF, ZF - 1);
+    float G011 = Gradient3D(Permutation[AB + 1], XF, YF - 1, ZF - 1);
+    float G111 = Gradient3D(Permutation[BB + 1], XF - 1, YF - 1, ZF - 1);
+    
     // Blend gradients
     float Result = Lerp(
         Lerp(
-            Lerp(Gradient3D(Permutation[AA], XF, YF, ZF),
-                 Gradient3D(Permutation[BA], XF - 1, YF, ZF), U),
-            Lerp(Gradient3D(Permutation[AB], XF, YF - 1, ZF),
-                 Gradient3D(Permutation[BB], XF - 1, YF - 1, ZF), U),
+            Lerp(G000, G100, U),
+            Lerp(G010, G110, U),
             V
         ),
         Lerp(
-            Lerp(Gradient3D(Permutation[AA + 1], XF, YF, ZF - 1),
-                 Gradient3D(Permutation[BA + 1], XF - 1, YF, ZF - 1), U),
-            Lerp(Gradient3D(Permutation[AB + 1], XF, YF - 1, ZF - 1),
-                 Gradient3D(Permutation[BB + 1], XF - 1, YF - 1, ZF - 1), U),
+            Lerp(G001, G101, U),
+            Lerp(G011, G111, U),
             V
         ),
         W
     );
-    
-    // Normalize to [0, 1]
-    return (Result + 1.0f) * 0.5f;
+
+    if (OutGradient)
+    {
+        // Derivative of the trilinear blend: interpolated corner gradients plus the fade-curve terms
+        const FVector3f C000(GradientVectors3D[Permutation[AA] & 15]);
+        const FVector3f C100(GradientVectors3D[Permutation[BA] & 15]);
+        const FVector3f C010(GradientVectors3D[Permutation[AB] & 15]);
+        const FVector3f C110(GradientVectors3D[Permutation[BB] & 15]);
+        const FVector3f C001(GradientVectors3D[Permutation[AA + 1] & 15]);
+        const FVector3f C101(GradientVectors3D[Permutation[BA + 1] & 15]);
+        const FVector3f C011(GradientVectors3D[Permutation[AB + 1] & 15]);
+        const FVector3f C111(GradientVectors3D[Permutation[BB + 1] & 15]);
+
+        const FVector3f Interpolated = FMath::Lerp(
+            FMath::Lerp(FMath::Lerp(C000, C100, U), FMath::Lerp(C010, C110, U), V),
+            FMath::Lerp(FMath::Lerp(C001, C101, U), FMath::Lerp(C011, C111, U), V),
+            W);
+
+        const float K1 = G100 - G000;
+        const float K2 = G010 - G000;
+        const float K3 = G001 - G000;
+        const float K4 = G000 - G100 - G010 + G110;
+        const float K5 = G000 - G010 - G001 + G011;
+        const float K6 = G000 - G100 - G001 + G101;
+        const float K7 = -G000 + G100 + G010 - G110 + G001 - G101 - G011 + G111;
+
+        *OutGradient = Interpolated + FVector3f(
+            FadeDerivative(XF) * (K1 + K4 * V + K6 * W + K7 * V * W),
+            FadeDerivative(YF) * (K2 + K5 * W + K4 * U + K7 * U * W),
+            FadeDerivative(ZF) * (K3 + K6 * U + K5 * V + K7 * U * V));
+    }
+
+    return Result;
+}
+
+float UVoxelNoiseGenerator::SimplexNoise3D(float X, float Y, float Z, FVector3f* OutGradient) const
+{
+    // Skew/unskew factors for 3D
+    const float F3 = 1.0f / 3.0f;
+    const float G3 = 1.0f / 6.0f;
+
+    // Find the simplex cell
+    const float S = (X + Y + Z) * F3;
+    const int32 I = FMath::FloorToInt(X + S);
+    const int32 J = FMath::FloorToInt(Y + S);
+    const int32 K = FMath::FloorToInt(Z + S);
+    const float T = (I + J + K) * G3;
+
+    // Position relative to the cell origin
+    const float X0 = X - (I - T);
+    const float Y0 = Y - (J - T);
+    const float Z0 = Z - (K - T);
+
+    // Determine which of the 6 tetrahedra we are in
+    int32 I1, J1, K1, I2, J2, K2;
+    if (X0 >= Y0)
+    {
+        if (Y0 >= Z0)      { I1 = 1; J1 = 0; K1 = 0; I2 = 1; J2 = 1; K2 = 0; }
+        else if (X0 >= Z0) { I1 = 1; J1 = 0; K1 = 0; I2 = 1; J2 = 0; K2 = 1; }
+        else               { I1 = 0; J1 = 0; K1 = 1; I2 = 1; J2 = 0; K2 = 1; }
+    }
+    else
+    {
+        if (Y0 < Z0)       { I1 = 0; J1 = 0; K1 = 1; I2 = 0; J2 = 1; K2 = 1; }
+        else if (X0 < Z0)  { I1 = 0; J1 = 1; K1 = 0; I2 = 0; J2 = 1; K2 = 1; }
+        else               { I1 = 0; J1 = 1; K1 = 0; I2 = 1; J2 = 1; K2 = 0; }
+    }
+
+    // Offsets of the 4 corners
+    const FVector3f Offsets[4] = {
+        FVector3f(X0, Y0, Z0),
+        FVector3f(X0 - I1 + G3, Y0 - J1 + G3, Z0 - K1 + G3),
+        FVector3f(X0 - I2 + 2.0f * G3, Y0 - J2 + 2.0f * G3, Z0 - K2 + 2.0f * G3),
+        FVector3f(X0 - 1.0f + 3.0f * G3, Y0 - 1.0f + 3.0f * G3, Z0 - 1.0f + 3.0f * G3)
+    };
+
+    // Hash the 4 corners (first 12 gradient vectors are the simplex edge directions)
+    const int32 II = I & 255;
+    const int32 JJ = J & 255;
+    const int32 KK = K & 255;
+    const int32 GradIndices[4] = {
+        Permutation[II + Permutation[JJ + Permutation[KK]]] % 12,
+        Permutation[II + I1 + Permutation[JJ + J1 + Permutation[KK + K1]]] % 12,
+        Permutation[II + I2 + Permutation[JJ + J2 + Permutation[KK + K2]]] % 12,
+        Permutation[II + 1 + Permutation[JJ + 1 + Permutation[KK + 1]]] % 12
+    };
+
+    float Result = 0.0f;
+    FVector3f Gradient = FVector3f::ZeroVector;
+
+    for (int32 Corner = 0; Corner < 4; ++Corner)
+    {
+        const FVector3f& P = Offsets[Corner];
+        const float Falloff = 0.6f - P.X * P.X - P.Y * P.Y - P.Z * P.Z;
+        if (Falloff <= 0.0f) continue;
+
+        const FVector3f Grad(GradientVectors3D[GradIndices[Corner]]);
+        const float Dot = Grad.X * P.X + Grad.Y * P.Y + Grad.Z * P.Z;
+        const float Falloff2 = Falloff * Falloff;
+        const float Falloff4 = Falloff2 * Falloff2;
+
+        Result += Falloff4 * Dot;
+
+        if (OutGradient)
+        {
+            // d/dP (t^4 * g.P) with t = 0.6 - |P|^2
+            Gradient += Grad * Falloff4 - P * (8.0f * Falloff2 * Falloff * Dot);
+        }
+    }
+
+    // Scale to roughly [-1, 1]
+    if (OutGradient)
+    {
+        *OutGradient = Gradient * 32.0f;
+    }
+    return Result * 32.0f;
 }
 
 float UVoxelNoiseGenerator::GetFractalNoise2D(float X, float Y, int32 Octaves, float Persistence, float Lacunarity) const
@@ -178,6 +323,30 @@ float UVoxelNoiseGenerator::GetFractalNoise3D(float X, float Y, float Z, int32 O
     return Total / MaxValue;
 }
 
+float UVoxelNoiseGenerator::GetFractalNoise3DWithGradient(float X, float Y, float Z, int32 Octaves, FVector& OutGradient, float Persistence, float Lacunarity) const
+{
+    float Total = 0.0f;
+    FVector GradientTotal = FVector::ZeroVector;
+    float Frequency = 1.0f;
+    float Amplitude = 1.0f;
+    float MaxValue = 0.0f;
+
+    for (int32 i = 0; i < Octaves; ++i)
+    {
+        FVector OctaveGradient;
+        Total += GetNoise3DWithGradient(X * Frequency, Y * Frequency, Z * Frequency, OctaveGradient) * Amplitude;
+
+        // Chain rule: each octave is sampled at Frequency * P
+        GradientTotal += OctaveGradient * (Amplitude * Frequency);
+        MaxValue += Amplitude;
+        Amplitude *= Persistence;
+        Frequency *= Lacunarity;
+    }
+
+    OutGradient = GradientTotal / MaxValue;
+    return Total / MaxValue;
+}
+
 float UVoxelNoiseGenerator::GetRidgedNoise2D(float X, float Y, int32 Octaves, float Persistence, float Lacunarity) const
 {
     float Total = 0.0f;
@@ -261,3 +430,181 @@ float UVoxelNoiseGenerator::GetVoronoiNoise2D(float X, float Y, float& OutCellX,
     
     return FMath::Sqrt(MinDist);
 }
+
+// ==========================================
+// Batched Noise
+// ==========================================
+
+VectorRegister4Float UVoxelNoiseGenerator::GetNoise3DVector(const VectorRegister4Float& X, const VectorRegister4Float& Y, const VectorRegister4Float& Z) const
+{
+    // Every operation mirrors GetNoise3D (no fused multiply-add) so results match the scalar path exactly
+    const VectorRegister4Float One = GlobalVectorConstants::FloatOne;
+
+    const VectorRegister4Float FloorX = VectorFloor(X);
+    const VectorRegister4Float FloorY = VectorFloor(Y);
+    const VectorRegister4Float FloorZ = VectorFloor(Z);
+
+    // Relative position in cell
+    const VectorRegister4Float XF = VectorSubtract(X, FloorX);
+    const VectorRegister4Float YF = VectorSubtract(Y, FloorY);
+    const VectorRegister4Float ZF = VectorSubtract(Z, FloorZ);
+    const VectorRegister4Float XF1 = VectorSubtract(XF, One);
+    const VectorRegister4Float YF1 = VectorSubtract(YF, One);
+    const VectorRegister4Float ZF1 = VectorSubtract(ZF, One);
+
+    // Fade curves: T * T * T * (T * (T * 6 - 15) + 10)
+    auto FadeVector = [](const VectorRegister4Float& T)
+    {
+        VectorRegister4Float Inner = VectorSubtract(VectorMultiply(T, VectorSetFloat1(6.0f)), VectorSetFloat1(15.0f));
+        Inner = VectorAdd(VectorMultiply(T, Inner), VectorSetFloat1(10.0f));
+        return VectorMultiply(VectorMultiply(VectorMultiply(T, T), T), Inner);
+    };
+    const VectorRegister4Float U = FadeVector(XF);
+    const VectorRegister4Float V = FadeVector(YF);
+    const VectorRegister4Float W = FadeVector(ZF);
+
+    // Hashing has no gather on SSE - resolve the 8 corner gradients per lane
+    alignas(16) float FloorValues[3][4];
+    VectorStoreAligned(FloorX, FloorValues[0]);
+    VectorStoreAligned(FloorY, FloorValues[1]);
+    VectorStoreAligned(FloorZ, FloorValues[2]);
+
+    // Corner order: AA, BA, AB, BB, AA+1, BA+1, AB+1, BB+1
+    alignas(16) float GradX[8][4];
+    alignas(16) float GradY[8][4];
+    alignas(16) float GradZ[8][4];
+
+    for (int32 Lane = 0; Lane < 4; ++Lane)
+    {
+        const int32 X0 = (int32)FloorValues[0][Lane] & 255;
+        const int32 Y0 = (int32)FloorValues[1][Lane] & 255;
+        const int32 Z0 = (int32)FloorValues[2][Lane] & 255;
+        const int32 X1 = (X0 + 1) & 255;
+
+        const int32 A = Permutation[X0] + Y0;
+        const int32 AA = Permutation[A] + Z0;
+        const int32 AB = Permutation[A + 1] + Z0;
+        const int32 B = Permutation[X1] + Y0;
+        const int32 BA = Permutation[B] + Z0;
+        const int32 BB = Permutation[B + 1] + Z0;
+
+        const int32 Corners[8] = {
+            Permutation[AA], Permutation[BA], Permutation[AB], Permutation[BB],
+            Permutation[AA + 1], Permutation[BA + 1], Permutation[AB + 1], Permutation[BB + 1]
+        };
+
+        for (int32 Corner = 0; Corner < 8; ++Corner)
+        {
+            const int32 GradIndex = Corners[Corner] & 15;
+            GradX[Corner][Lane] = GradientX3D[GradIndex];
+            GradY[Corner][Lane] = GradientY3D[GradIndex];
+            GradZ[Corner][Lane] = GradientZ3D[GradIndex];
+        }
+    }
+
+    auto Gradient = [&GradX, &GradY, &GradZ](int32 Corner, const VectorRegister4Float& PX, const VectorRegister4Float& PY, const VectorRegister4Float& PZ)
+    {
+        VectorRegister4Float Result = VectorMultiply(VectorLoadAligned(GradX[Corner]), PX);
+        Result = VectorAdd(Result, VectorMultiply(VectorLoadAligned(GradY[Corner]), PY));
+        return VectorAdd(Result, VectorMultiply(VectorLoadAligned(GradZ[Corner]), PZ));
+    };
+
+    auto LerpVector = [](const VectorRegister4Float& A, const VectorRegister4Float& B, const VectorRegister4Float& T)
+    {
+        return VectorAdd(A, VectorMultiply(T, VectorSubtract(B, A)));
+    };
+
+    // Blend gradients
+    const VectorRegister4Float Result = LerpVector(
+        LerpVector(
+            LerpVector(Gradient(0, XF, YF, ZF), Gradient(1, XF1, YF, ZF), U),
+            LerpVector(Gradient(2, XF, YF1, ZF), Gradient(3, XF1, YF1, ZF), U),
+            V
+        ),
+        LerpVector(
+            LerpVector(Gradient(4, XF, YF, ZF1), Gradient(5, XF1, YF, ZF1), U),
+            LerpVector(Gradient(6, XF, YF1, ZF1), Gradient(7, XF1, YF1, ZF1), U),
+            V
+        ),
+        W
+    );
+
+    // Normalize to [0, 1]
+    return VectorMultiply(VectorAdd(Result, One), GlobalVectorConstants::FloatOneHalf);
+}
+
+void UVoxelNoiseGenerator::GetFractalNoise3DBatch(const float* X, const float* Y, const float* Z, float* OutValues, int32 Num,
+    int32 Octaves, float Persistence, float Lacunarity) const
+{
+    int32 Index = 0;
+
+#if PLATFORM_ENABLE_VECTORINTRINSICS
+    for (; NoiseType == EVoxelNoiseType::Perlin && Index + 4 <= Num; Index += 4)
+    {
+        const VectorRegister4Float PX = VectorLoad(X + Index);
+        const VectorRegister4Float PY = VectorLoad(Y + Index);
+        const VectorRegister4Float PZ = VectorLoad(Z + Index);
+
+        VectorRegister4Float Total = VectorZeroFloat();
+        float Frequency = 1.0f;
+        float Amplitude = 1.0f;
+        float MaxValue = 0.0f;
+
+        for (int32 i = 0; i < Octaves; ++i)
+        {
+            const VectorRegister4Float Freq = VectorSetFloat1(Frequency);
+            const VectorRegister4Float Noise = GetNoise3DVector(VectorMultiply(PX, Freq), VectorMultiply(PY, Freq), VectorMultiply(PZ, Freq));
+            Total = VectorAdd(Total, VectorMultiply(Noise, VectorSetFloat1(Amplitude)));
+            MaxValue += Amplitude;
+            Amplitude *= Persistence;
+            Frequency *= Lacunarity;
+        }
+
+        VectorStore(VectorDivide(Total, VectorSetFloat1(MaxValue)), OutValues + Index);
+    }
+#endif
+
+    // Scalar fallback and remainder
+    for (; Index < Num; ++Index)
+    {
+        OutValues[Index] = GetFractalNoise3D(X[Index], Y[Index], Z[Index], Octaves, Persistence, Lacunarity);
+    }
+}
+
+void UVoxelNoiseGenerator::GetFractalNoise3DGrid(const FVector3f& Origin, const FVector3f& Step, const FIntVector& Dimensions,
+    int32 Octaves, float Persistence, float Lacunarity, TArray<float>& OutValues) const
+{
+    const int32 NumPoints = FMath::Max(0, Dimensions.X) * FMath::Max(0, Dimensions.Y) * FMath::Max(0, Dimensions.Z);
+    OutValues.SetNumUninitialized(NumPoints);
+    if (NumPoints == 0) return;
+
+    // Evaluate one X row at a time
+    TArray<float> RowX, RowY, RowZ;
+    RowX.SetNumUninitialized(Dimensions.X);
+    RowY.SetNumUninitialized(Dimensions.X);
+    RowZ.SetNumUninitialized(Dimensions.X);
+
+    for (int32 I = 0; I < Dimensions.X; ++I)
+    {
+        RowX[I] = Origin.X + (float)I * Step.X;
+    }
+
+    for (int32 K = 0; K < Dimensions.Z; ++K)
+    {
+        const float PointZ = Origin.Z + (float)K * Step.Z;
+
+        for (int32 J = 0; J < Dimensions.Y; ++J)
+        {
+            const float PointY = Origin.Y + (float)J * Step.Y;
+
+            for (int32 I = 0; I < Dimensions.X; ++I)
+            {
+                RowY[I] = PointY;
+                RowZ[I] = PointZ;
+            }
+
+            float* Out = OutValues.GetData() + (J + K * Dimensions.Y) * Dimensions.X;
+            GetFractalNoise3DBatch(RowX.GetData(), RowY.GetData(), RowZ.GetData(), Out, Dimensions.X, Octaves, Persistence, Lacunarity);
+        }
+    }
+}
@@ -4,6 +4,9 @@
 #include "VoxelWorldManager.h"
 #include "VoxelWorldModule.h"
 #include "EngineUtils.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+#include "Camera/PlayerCameraManager.h"
 #include "DrawDebugHelpers.h"
 
 UVoxelPlayerTracker::UVoxelPlayerTracker()
@@ -63,6 +66,22 @@ void UVoxelPlayerTracker::TickComponent(float DeltaTime, ELevelTick TickType, FA
             FVector PlayerPosition = Owner->GetActorLocation();
             VoxelWorldManager->SetLoadCenter(PlayerPosition);
 
+            // Queued work is scored by where the player looks and moves - the camera if there is one, the eyes otherwise
+            FVector ViewLocation;
+            FRotator ViewRotation;
+            float FOVDegrees = 90.0f;
+            Owner->GetActorEyesViewPoint(ViewLocation, ViewRotation);
+
+            const APawn* Pawn = Cast<APawn>(Owner);
+            const APlayerController* PlayerController = Pawn ? Cast<APlayerController>(Pawn->GetController()) : nullptr;
+            if (PlayerController && PlayerController->PlayerCameraManager)
+            {
+                PlayerController->PlayerCameraManager->GetCameraViewPoint(ViewLocation, ViewRotation);
+                FOVDegrees = PlayerController->PlayerCameraManager->GetFOVAngle();
+            }
+
+            VoxelWorldManager->SetViewInfo(ViewLocation, ViewRotation.Vector(), FOVDegrees, Owner->GetVelocity());
+
             if (bShowDebugInfo)
             {
                 // Draw debug info
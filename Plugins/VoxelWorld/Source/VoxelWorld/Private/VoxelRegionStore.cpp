@@ -0,0 +1,566 @@
+// Copyright Your Company. All Rights Reserved.
+
+#include "VoxelRegionStore.h"
+#include "VoxelWorldModule.h"
+#include "HAL/PlatformFileManager.h"
+#include "Async/MappedFileHandle.h"
+#include "Misc/Paths.h"
+#include "Tasks/Task.h"
+
+namespace
+{
+    FORCEINLINE int32 FloorDiv(int32 Value, int32 Divisor)
+    {
+        return Value >= 0 ? Value / Divisor : (Value - Divisor + 1) / Divisor;
+    }
+}
+
+// ==========================================
+// Region File
+// ==========================================
+
+FVoxelRegionFile::FVoxelRegionFile(const FString& InPath, int32 InChunkSize)
+    : Path(InPath)
+    , ChunkSize(InChunkSize)
+{
+    Entries.SetNum(NumEntries);
+}
+
+FVoxelRegionFile::~FVoxelRegionFile()
+{
+    Unmap();
+}
+
+FIntVector FVoxelRegionFile::GetRegionCoord(const FChunkCoord& Coord)
+{
+    return FIntVector(FloorDiv(Coord.X, RegionSizeXY), FloorDiv(Coord.Y, RegionSizeXY), FloorDiv(Coord.Z, RegionSizeZ));
+}
+
+int32 FVoxelRegionFile::GetEntryIndex(const FChunkCoord& Coord)
+{
+    const FIntVector Region = GetRegionCoord(Coord);
+    const int32 X = Coord.X - Region.X * RegionSizeXY;
+    const int32 Y = Coord.Y - Region.Y * RegionSizeXY;
+    const int32 Z = Coord.Z - Region.Z * RegionSizeZ;
+    return X + Y * RegionSizeXY + Z * RegionSizeXY * RegionSizeXY;
+}
+
+FString FVoxelRegionFile::GetBackupPath() const
+{
+    return Path + TEXT(".bak");
+}
+
+void FVoxelRegionFile::Load()
+{
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+    // A compaction interrupted mid-swap leaves the old file as a backup - restore it if the new one never arrived
+    const FString BackupPath = GetBackupPath();
+    if (PlatformFile.FileExists(*BackupPath))
+    {
+        if (PlatformFile.FileExists(*Path))
+        {
+            PlatformFile.DeleteFile(*BackupPath);
+        }
+        else if (!PlatformFile.MoveFile(*Path, *BackupPath))
+        {
+            UE_LOG(LogVoxelWorld, Warning, TEXT("Could not restore region file %s from its backup"), *Path);
+        }
+    }
+    PlatformFile.DeleteFile(*(Path + TEXT(".tmp")));
+
+    TUniquePtr<IFileHandle> Handle(PlatformFile.OpenRead(*Path));
+    if (!Handle)
+    {
+        return;
+    }
+
+    FHeader Header;
+    const int64 Size = Handle->Size();
+    if (Size < PayloadStart || !Handle->Read(reinterpret_cast<uint8*>(&Header), sizeof(Header)))
+    {
+        UE_LOG(LogVoxelWorld, Warning, TEXT("Region file %s is truncated - ignoring it"), *Path);
+        return;
+    }
+
+    if (Header.Magic != Magic || Header.Version != Version || Header.ChunkSize != ChunkSize || Header.NumEntries != NumEntries)
+    {
+        UE_LOG(LogVoxelWorld, Warning, TEXT("Region file %s was written with a different format or chunk size - ignoring it"), *Path);
+        return;
+    }
+
+    TArray<FEntry> Table;
+    Table.SetNumUninitialized(NumEntries);
+    if (!Handle->Read(reinterpret_cast<uint8*>(Table.GetData()), sizeof(FEntry) * NumEntries))
+    {
+        return;
+    }
+
+    // Drop entries pointing past the end (a write interrupted before the table update never shows up here)
+    // and entries whose size no edit layer of this chunk size can have - the loader allocates what the entry claims
+    const int64 MaxUncompressedSize = FVoxelEditLayer::GetMaxSerializedSize(ChunkSize);
+    int64 LiveBytes = 0;
+    for (FEntry& Entry : Table)
+    {
+        if (Entry.Offset != 0 && (Entry.Offset < PayloadStart || static_cast<int64>(Entry.Offset) + Entry.CompressedSize > Size
+            || Entry.CompressedSize == 0 || Entry.UncompressedSize == 0 || Entry.UncompressedSize > MaxUncompressedSize))
+        {
+            Entry = FEntry();
+        }
+        LiveBytes += Entry.CompressedSize;
+    }
+
+    Entries = MoveTemp(Table);
+    FileSize = Size;
+    DeadBytes = FMath::Max<int64>(0, Size - PayloadStart - LiveBytes);
+}
+
+TBitArray<> FVoxelRegionFile::GetOccupancy() const
+{
+    TBitArray<> Bits(false, NumEntries);
+    for (int32 Index = 0; Index < NumEntries; ++Index)
+    {
+        Bits[Index] = Entries[Index].Offset != 0;
+    }
+    return Bits;
+}
+
+bool FVoxelRegionFile::EnsureMapped()
+{
+    if (MappedRegion)
+    {
+        return true;
+    }
+
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    MappedHandle.Reset(PlatformFile.OpenMapped(*Path));
+    if (!MappedHandle)
+    {
+        return false;
+    }
+
+    MappedRegion.Reset(MappedHandle->MapRegion(0, MappedHandle->GetFileSize()));
+    if (!MappedRegion)
+    {
+        MappedHandle.Reset();
+        return false;
+    }
+
+    return true;
+}
+
+void FVoxelRegionFile::Unmap()
+{
+    // Regions must go before the handle they were mapped from
+    MappedRegion.Reset();
+    MappedHandle.Reset();
+}
+
+bool FVoxelRegionFile::Read(int32 EntryIndex, FVoxelEditLayer& OutEdits)
+{
+    const FEntry& Entry = Entries[EntryIndex];
+    if (Entry.Offset == 0)
+    {
+        return true;
+    }
+
+    // Zero-copy - the decompressor reads the payload in place from the page cache
+    if (EnsureMapped() && static_cast<int64>(Entry.Offset) + Entry.CompressedSize <= MappedRegion->GetMappedSize())
+    {
+        return FVoxelChunkData::DecompressEdits(MappedRegion->GetMappedPtr() + Entry.Offset, Entry.CompressedSize, Entry.UncompressedSize, OutEdits);
+    }
+
+    // Platforms without mapping support fall back to a plain read
+    TUniquePtr<IFileHandle> Handle(FPlatformFileManager::Get().GetPlatformFile().OpenRead(*Path));
+    TArray<uint8> Payload;
+    Payload.SetNumUninitialized(Entry.CompressedSize);
+    if (!Handle || !Handle->Seek(Entry.Offset) || !Handle->Read(Payload.GetData(), Payload.Num()))
+    {
+        return false;
+    }
+
+    return FVoxelChunkData::DecompressEdits(Payload.GetData(), Payload.Num(), Entry.UncompressedSize, OutEdits);
+}
+
+bool FVoxelRegionFile::WriteHeader(IFileHandle& Handle, const TArray<FEntry>& InEntries) const
+{
+    FHeader Header;
+    Header.Magic = Magic;
+    Header.Version = Version;
+    Header.ChunkSize = ChunkSize;
+    Header.NumEntries = NumEntries;
+
+    return Handle.Seek(0)
+        && Handle.Write(reinterpret_cast<const uint8*>(&Header), sizeof(Header))
+        && Handle.Write(reinterpret_cast<const uint8*>(InEntries.GetData()), sizeof(FEntry) * InEntries.Num());
+}
+
+bool FVoxelRegionFile::Write(int32 EntryIndex, const TArray<uint8>& Payload, int32 UncompressedSize)
+{
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+    // Offsets are 32-bit - dead payloads may free enough room once the file is rewritten
+    if (Payload.Num() > 0 && FileSize + Payload.Num() > MAX_uint32 && (DeadBytes == 0 || !Compact() || FileSize + Payload.Num() > MAX_uint32))
+    {
+        UE_LOG(LogVoxelWorld, Warning, TEXT("Region file %s is full"), *Path);
+        return false;
+    }
+
+    // The mapping covers the old file size, and some platforms refuse to grow a mapped file
+    Unmap();
+
+    const bool bNewFile = FileSize < PayloadStart;
+    if (bNewFile)
+    {
+        PlatformFile.CreateDirectoryTree(*FPaths::GetPath(Path));
+    }
+
+    TUniquePtr<IFileHandle> Handle(PlatformFile.OpenWrite(*Path, !bNewFile, true));
+    if (!Handle)
+    {
+        UE_LOG(LogVoxelWorld, Warning, TEXT("Could not open region file %s for writing"), *Path);
+        return false;
+    }
+
+    if (bNewFile)
+    {
+        Entries.Init(FEntry(), NumEntries);
+        FileSize = PayloadStart;
+        DeadBytes = 0;
+        if (!WriteHeader(*Handle, Entries))
+        {
+            return false;
+        }
+    }
+
+    FEntry NewEntry;
+    if (Payload.Num() > 0)
+    {
+        // Append-only: the payload lands past everything else, so a crash mid-write leaves the old entry intact
+        // Flushed on its own, so the entry below never reaches disk ahead of the bytes it points at
+        if (!Handle->Seek(FileSize) || !Handle->Write(Payload.GetData(), Payload.Num()) || !Handle->Flush())
+        {
+            return false;
+        }
+
+        NewEntry.Offset = static_cast<uint32>(FileSize);
+        NewEntry.CompressedSize = Payload.Num();
+        NewEntry.UncompressedSize = UncompressedSize;
+        FileSize += Payload.Num();
+    }
+
+    // Only then repoint the entry
+    const int64 EntryOffset = sizeof(FHeader) + sizeof(FEntry) * EntryIndex;
+    if (!Handle->Seek(EntryOffset) || !Handle->Write(reinterpret_cast<const uint8*>(&NewEntry), sizeof(NewEntry)))
+    {
+        return false;
+    }
+
+    DeadBytes += Entries[EntryIndex].CompressedSize;
+    Entries[EntryIndex] = NewEntry;
+
+    return Handle->Flush();
+}
+
+bool FVoxelRegionFile::NeedsCompaction() const
+{
+    constexpr int64 MinDeadBytes = 64 * 1024;
+    return DeadBytes > MinDeadBytes && DeadBytes * 2 > FileSize - PayloadStart;
+}
+
+bool FVoxelRegionFile::Compact()
+{
+    if (!EnsureMapped())
+    {
+        return false;
+    }
+
+    IPlatformFile& PlatformFile = FPlatformFileManager::Get().GetPlatformFile();
+    const FString TempPath = Path + TEXT(".tmp");
+
+    TArray<FEntry> NewEntries;
+    NewEntries.Init(FEntry(), NumEntries);
+    int64 NewSize = PayloadStart;
+
+    {
+        TUniquePtr<IFileHandle> Handle(PlatformFile.OpenWrite(*TempPath));
+        if (!Handle || !Handle->Seek(PayloadStart))
+        {
+            return false;
+        }
+
+        // Live payloads are copied straight from the mapping, in table order
+        const uint8* Mapped = MappedRegion->GetMappedPtr();
+        for (int32 Index = 0; Index < NumEntries; ++Index)
+        {
+            const FEntry& Entry = Entries[Index];
+            if (Entry.Offset == 0)
+            {
+                continue;
+            }
+
+            if (!Handle->Write(Mapped + Entry.Offset, Entry.CompressedSize))
+            {
+                Handle.Reset();
+                PlatformFile.DeleteFile(*TempPath);
+                return false;
+            }
+
+            NewEntries[Index] = Entry;
+            NewEntries[Index].Offset = static_cast<uint32>(NewSize);
+            NewSize += Entry.CompressedSize;
+        }
+
+        if (!WriteHeader(*Handle, NewEntries) || !Handle->Flush())
+        {
+            Handle.Reset();
+            PlatformFile.DeleteFile(*TempPath);
+            return false;
+        }
+    }
+
+    Unmap();
+
+    // Swap through a backup - the old file is only deleted once the new one is in place, and Load restores
+    // the backup if the process dies in between
+    const FString BackupPath = GetBackupPath();
+    PlatformFile.DeleteFile(*BackupPath);
+
+    if (!PlatformFile.MoveFile(*BackupPath, *Path))
+    {
+        UE_LOG(LogVoxelWorld, Warning, TEXT("Could not replace region file %s after compaction"), *Path);
+        PlatformFile.DeleteFile(*TempPath);
+        return false;
+    }
+
+    if (!PlatformFile.MoveFile(*Path, *TempPath))
+    {
+        // Entries still describe the old file, so put it back
+        UE_LOG(LogVoxelWorld, Warning, TEXT("Could not replace region file %s after compaction"), *Path);
+        PlatformFile.MoveFile(*Path, *BackupPath);
+        PlatformFile.DeleteFile(*TempPath);
+        return false;
+    }
+
+    PlatformFile.DeleteFile(*BackupPath);
+
+    UE_LOG(LogVoxelWorld, Verbose, TEXT("Compacted region file %s: %lld -> %lld bytes"), *Path, FileSize, NewSize);
+
+    Entries = MoveTemp(NewEntries);
+    FileSize = NewSize;
+    DeadBytes = 0;
+
+    return true;
+}
+
+// ==========================================
+// Region Store
+// ==========================================
+
+FVoxelRegionStore::FVoxelRegionStore(const FString& InDirectory, int32 InChunkSize)
+    : Directory(InDirectory)
+    , ChunkSize(InChunkSize)
+{
+}
+
+FVoxelRegionStore::~FVoxelRegionStore()
+{
+    // Whatever is still queued would otherwise be lost
+    Flush();
+}
+
+FString FVoxelRegionStore::GetSaveDirectory(const FString& SlotName, int32 Seed)
+{
+    return FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("VoxelWorld"), SlotName, FString::Printf(TEXT("%d"), Seed));
+}
+
+FVoxelRegionFile& FVoxelRegionStore::GetRegion(const FChunkCoord& Coord)
+{
+    return GetRegionAt(FVoxelRegionFile::GetRegionCoord(Coord));
+}
+
+FVoxelRegionFile& FVoxelRegionStore::GetRegionAt(const FIntVector& RegionCoord)
+{
+    if (TUniquePtr<FVoxelRegionFile>* Existing = Regions.Find(RegionCoord))
+    {
+        return **Existing;
+    }
+
+    const FString Path = FPaths::Combine(Directory, FString::Printf(TEXT("r.%d.%d.%d.vxr"), RegionCoord.X, RegionCoord.Y, RegionCoord.Z));
+    TUniquePtr<FVoxelRegionFile> Region = MakeUnique<FVoxelRegionFile>(Path, ChunkSize);
+    Region->Load();
+
+    // Built before taking the lock, so lookups only ever wait for the swap
+    TBitArray<> Bits = Region->GetOccupancy();
+    {
+        FRWScopeLock Lock(OccupancyLock, SLT_Write);
+        Occupancy.Add(RegionCoord, MoveTemp(Bits));
+        OccupancyRequests.Remove(RegionCoord);
+    }
+
+    return *Regions.Add(RegionCoord, MoveTemp(Region));
+}
+
+void FVoxelRegionStore::SetOccupied(const FChunkCoord& Coord, bool bOccupied)
+{
+    FRWScopeLock Lock(OccupancyLock, SLT_Write);
+    if (TBitArray<>* Bits = Occupancy.Find(FVoxelRegionFile::GetRegionCoord(Coord)))
+    {
+        (*Bits)[FVoxelRegionFile::GetEntryIndex(Coord)] = bOccupied;
+    }
+}
+
+bool FVoxelRegionStore::MayHaveChunk(const FChunkCoord& Coord)
+{
+    {
+        FScopeLock Lock(&PendingLock);
+        if (const FVoxelChunkDataSnapshot* Pending = PendingSaves.Find(Coord))
+        {
+            return (*Pending)->HasEdits();
+        }
+    }
+
+    const FIntVector RegionCoord = FVoxelRegionFile::GetRegionCoord(Coord);
+    {
+        FRWScopeLock Lock(OccupancyLock, SLT_ReadOnly);
+        if (const TBitArray<>* Bits = Occupancy.Find(RegionCoord))
+        {
+            return (*Bits)[FVoxelRegionFile::GetEntryIndex(Coord)];
+        }
+    }
+
+    // Table not read yet - read it on a worker and assume edits meanwhile (the generation job loads them either way)
+    bool bAlreadyRequested = false;
+    {
+        FRWScopeLock Lock(OccupancyLock, SLT_Write);
+        OccupancyRequests.Add(RegionCoord, &bAlreadyRequested);
+    }
+
+    if (!bAlreadyRequested)
+    {
+        UE::Tasks::Launch(TEXT("VoxelRegionOccupancy"), [Store = AsShared(), RegionCoord]()
+        {
+            FScopeLock Lock(&Store->FileLock);
+            Store->GetRegionAt(RegionCoord);
+        });
+    }
+
+    return true;
+}
+
+bool FVoxelRegionStore::LoadEdits(const FChunkCoord& Coord, FVoxelEditLayer& OutEdits)
+{
+    // A queued save is newer than anything on disk
+    FVoxelChunkDataSnapshot Pending;
+    {
+        FScopeLock Lock(&PendingLock);
+        if (const FVoxelChunkDataSnapshot* Found = PendingSaves.Find(Coord))
+        {
+            Pending = *Found;
+        }
+    }
+
+    if (Pending.IsValid())
+    {
+        FVoxelChunkData Data;
+        if (!Data.TakeEditsFrom(*Pending))
+        {
+            return false;
+        }
+        OutEdits = MoveTemp(Data.Edits);
+        return true;
+    }
+
+    FScopeLock Lock(&FileLock);
+    return GetRegion(Coord).Read(FVoxelRegionFile::GetEntryIndex(Coord), OutEdits);
+}
+
+void FVoxelRegionStore::SaveEdits(const FChunkCoord& Coord, const FVoxelChunkDataSnapshot& Data)
+{
+    if (!Data.IsValid())
+    {
+        return;
+    }
+
+    FScopeLock Lock(&PendingLock);
+    PendingSaves.Add(Coord, Data);
+}
+
+int32 FVoxelRegionStore::NumPendingSaves() const
+{
+    FScopeLock Lock(&PendingLock);
+    return PendingSaves.Num();
+}
+
+void FVoxelRegionStore::Flush()
+{
+    FScopeLock FlushScope(&FlushLock);
+
+    // Saves stay queued until written, so loads keep finding them in the meantime
+    TArray<TPair<FChunkCoord, FVoxelChunkDataSnapshot>> Saves;
+    {
+        FScopeLock Lock(&PendingLock);
+        Saves.Reserve(PendingSaves.Num());
+        for (const auto& Pair : PendingSaves)
+        {
+            Saves.Emplace(Pair.Key, Pair.Value);
+        }
+    }
+
+    if (Saves.Num() == 0)
+    {
+        return;
+    }
+
+    TSet<FIntVector> TouchedRegions;
+    int32 NumWritten = 0;
+
+    for (const auto& Save : Saves)
+    {
+        // Compression runs outside the file lock; cold data is already compressed and goes out as it is
+        TArray<uint8> Payload;
+        int32 UncompressedSize = 0;
+        if (!Save.Value->GetCompressedEdits(Payload, UncompressedSize))
+        {
+            UE_LOG(LogVoxelWorld, Warning, TEXT("Chunk %s: Could not compress edits for saving"), *Save.Key.ToString());
+            continue;
+        }
+
+        {
+            FScopeLock Lock(&FileLock);
+            if (GetRegion(Save.Key).Write(FVoxelRegionFile::GetEntryIndex(Save.Key), Payload, UncompressedSize))
+            {
+                SetOccupied(Save.Key, Payload.Num() > 0);
+                TouchedRegions.Add(FVoxelRegionFile::GetRegionCoord(Save.Key));
+                NumWritten++;
+            }
+            else
+            {
+                // Kept queued - loads still see the edits and the next flush tries again
+                UE_LOG(LogVoxelWorld, Warning, TEXT("Chunk %s: Could not write edits to its region file, will retry"), *Save.Key.ToString());
+                continue;
+            }
+        }
+
+        // A newer save queued meanwhile stays for the next flush
+        FScopeLock Lock(&PendingLock);
+        const FVoxelChunkDataSnapshot* Current = PendingSaves.Find(Save.Key);
+        if (Current && *Current == Save.Value)
+        {
+            PendingSaves.Remove(Save.Key);
+        }
+    }
+
+    // Compaction piggybacks on flushes, and only touches regions that just grew
+    FScopeLock Lock(&FileLock);
+    for (const FIntVector& RegionCoord : TouchedRegions)
+    {
+        FVoxelRegionFile& Region = *Regions.FindChecked(RegionCoord);
+        if (Region.NeedsCompaction())
+        {
+            Region.Compact();
+        }
+    }
+
+    UE_LOG(LogVoxelWorld, Verbose, TEXT("Saved %d chunks to %d region files"), NumWritten, TouchedRegions.Num());
+}
@@ -15,12 +15,14 @@ void UVoxelTerrainGenerator::Initialize(const FVoxelWorldSettings& Settings)
 
     NoiseGenerator = NewObject<UVoxelNoiseGenerator>(this);
     NoiseGenerator->Initialize(Settings.Seed);
+    NoiseGenerator->SetNoiseType(Settings.NoiseType);
 
-    // Clear any cached values
-    CachedBiomeNoise.Empty();
+    // Cached columns belong to the previous seed/settings
+    ColumnCache.Reset();
 
-    UE_LOG(LogVoxelWorld, Log, TEXT("Terrain generator initialized with seed: %d, Plateaus: %s, Valleys: %s, Cave Entrances: ON"),
+    UE_LOG(LogVoxelWorld, Log, TEXT("Terrain generator initialized with seed: %d, Noise: %s, Plateaus: %s, Valleys: %s, Cave Entrances: ON"),
         Settings.Seed,
+        Settings.NoiseType == EVoxelNoiseType::Simplex ? TEXT("Simplex") : TEXT("Perlin"),
         Settings.BiomeSettings.bEnablePlateaus ? TEXT("ON") : TEXT("OFF"),
         Settings.BiomeSettings.bEnableValleys ? TEXT("ON") : TEXT("OFF"));
 }
@@ -158,8 +160,14 @@ float UVoxelTerrainGenerator::GetCaveEntranceInfluence(int32 WorldX, int32 World
 {
     if (!NoiseGenerator || !WorldSettings.bGenerateCaves) return 0.0f;
 
+    return GetCaveEntranceInfluenceFromPlateau(WorldX, WorldY, GetPlateauInfluence(WorldX, WorldY));
+}
+
+float UVoxelTerrainGenerator::GetCaveEntranceInfluenceFromPlateau(int32 WorldX, int32 WorldY, float PlateauInf) const
+{
+    if (!NoiseGenerator || !WorldSettings.bGenerateCaves) return 0.0f;
+
     // Don't place entrances on plateaus (they'd just be holes in the plateau)
-    float PlateauInf = GetPlateauInfluence(WorldX, WorldY);
     if (PlateauInf > 0.5f) return 0.0f;
 
     // Use ridged noise to create natural ravine-like entrance shapes
@@ -219,13 +227,19 @@ void UVoxelTerrainGenerator::GetShaftParameters(float TerrainHeight, float& OutS
 
 bool UVoxelTerrainGenerator::IsInCaveEntrance(int32 WorldX, int32 WorldY, int32 WorldZ) const
 {
-    float EntranceInfluence = GetCaveEntranceInfluence(WorldX, WorldY);
-    if (EntranceInfluence < 0.15f) return false;
+    FVoxelColumnData Column;
+    GetColumnData(WorldX, WorldY, Column);
+    return IsInCaveEntranceFromColumn(Column, WorldZ);
+}
 
-    float TerrainHeight = GetTerrainHeight(WorldX, WorldY);
+bool UVoxelTerrainGenerator::IsInCaveEntranceFromColumn(const FVoxelColumnData& Column, int32 WorldZ) const
+{
+    const float EntranceInfluence = Column.EntranceInfluence;
+    if (EntranceInfluence < 0.15f) return false;
 
-    float ShaftTop, ShaftBottom, ChamberBottom;
-    GetShaftParameters(TerrainHeight, ShaftTop, ShaftBottom, ChamberBottom);
+    const float ShaftTop = Column.ShaftTop;
+    const float ShaftBottom = Column.ShaftBottom;
+    const float ChamberBottom = Column.ChamberBottom;
 
     // Check if in vertical shaft
     if (WorldZ <= ShaftTop && WorldZ >= ShaftBottom)
@@ -253,13 +267,19 @@ bool UVoxelTerrainGenerator::IsInCaveEntrance(int32 WorldX, int32 WorldY, int32
 
 float UVoxelTerrainGenerator::GetEntranceShaftDensity(int32 WorldX, int32 WorldY, int32 WorldZ) const
 {
-    float EntranceInfluence = GetCaveEntranceInfluence(WorldX, WorldY);
-    if (EntranceInfluence < 0.1f) return -1.0f;
+    FVoxelColumnData Column;
+    GetColumnData(WorldX, WorldY, Column);
+    return GetEntranceShaftDensityFromColumn(Column, WorldX, WorldY, WorldZ);
+}
 
-    float TerrainHeight = GetTerrainHeight(WorldX, WorldY);
+float UVoxelTerrainGenerator::GetEntranceShaftDensityFromColumn(const FVoxelColumnData& Column, int32 WorldX, int32 WorldY, int32 WorldZ) const
+{
+    const float EntranceInfluence = Column.EntranceInfluence;
+    if (EntranceInfluence < 0.1f) return -1.0f;
 
-    float ShaftTop, ShaftBottom, ChamberBottom;
-    GetShaftParameters(TerrainHeight, ShaftTop, ShaftBottom, ChamberBottom);
+    const float ShaftTop = Column.ShaftTop;
+    const float ShaftBottom = Column.ShaftBottom;
+    const float ChamberBottom = Column.ChamberBottom;
 
     // Above shaft - solid
     if (WorldZ > ShaftTop) return -1.0f;
@@ -338,16 +358,14 @@ float UVoxelTerrainGenerator::GetEntranceTunnelDensity(int32 WorldX, int32 World
 {
     if (!NoiseGenerator) return -1.0f;
 
-    float EntranceInfluence = GetCaveEntranceInfluence(WorldX, WorldY);
-    if (EntranceInfluence < 0.05f) return -1.0f;
-
-    float TerrainHeight = GetTerrainHeight(WorldX, WorldY);
-
-    float ShaftTop, ShaftBottom, ChamberBottom;
-    GetShaftParameters(TerrainHeight, ShaftTop, ShaftBottom, ChamberBottom);
+    FVoxelColumnData Column;
+    GetColumnData(WorldX, WorldY, Column);
+    return GetEntranceTunnelDensityFromColumn(Column, WorldX, WorldY, WorldZ);
+}
 
-    // Tunnels only form in the chamber depth range
-    if (WorldZ > ShaftBottom || WorldZ < ChamberBottom - 5) return -1.0f;
+float UVoxelTerrainGenerator::GetEntranceTunnelNoise(int32 WorldX, int32 WorldY) const
+{
+    if (!NoiseGenerator) return 0.0f;
 
     // Create radial tunnels extending outward from high-influence areas
     // Use domain-warped noise to create winding tunnels
@@ -367,11 +385,24 @@ float UVoxelTerrainGenerator::GetEntranceTunnelDensity(int32 WorldX, int32 World
     ) * 20.0f;
 
     // Tunnel pattern - creates branching passages
-    float TunnelNoise = NoiseGenerator->GetRidgedNoise2D(
+    return NoiseGenerator->GetRidgedNoise2D(
         (WorldX + WarpX) * TunnelFreq + 77000.0f,
         (WorldY + WarpY) * TunnelFreq + 77000.0f,
         2, 0.5f, 2.0f
     );
+}
+
+float UVoxelTerrainGenerator::GetEntranceTunnelDensityFromColumn(const FVoxelColumnData& Column, int32 WorldX, int32 WorldY, int32 WorldZ) const
+{
+    if (!NoiseGenerator) return -1.0f;
+
+    const float EntranceInfluence = Column.EntranceInfluence;
+    if (EntranceInfluence < 0.05f) return -1.0f;
+
+    // Tunnels only form in the chamber depth range
+    if (WorldZ > Column.ShaftBottom || WorldZ < Column.ChamberBottom - 5) return -1.0f;
+
+    const float TunnelNoise = Column.EntranceTunnelNoise;
 
     // Tunnels form along ridges of the noise, but only near entrances
     // The influence falloff creates tunnels that extend from entrances
@@ -488,14 +519,18 @@ float UVoxelTerrainGenerator::Get3DTerrainVariation(int32 WorldX, int32 WorldY,
 
 EBiomeType UVoxelTerrainGenerator::GetBiome(int32 WorldX, int32 WorldY) const
 {
-    float Temperature = GetTemperature(WorldX, WorldY);
-    float Moisture = GetMoisture(WorldX, WorldY);
+    return GetBiomeFromFactors(WorldX, WorldY,
+        GetTemperature(WorldX, WorldY),
+        GetMoisture(WorldX, WorldY),
+        GetPlateauInfluence(WorldX, WorldY),
+        GetValleyInfluence(WorldX, WorldY));
+}
+
+EBiomeType UVoxelTerrainGenerator::GetBiomeFromFactors(int32 WorldX, int32 WorldY, float Temperature, float Moisture, float PlateauInf, float ValleyInf) const
+{
     float Continentalness = GetContinentalness(WorldX, WorldY);
 
     // Check for terrain features first
-    float PlateauInf = GetPlateauInfluence(WorldX, WorldY);
-    float ValleyInf = GetValleyInfluence(WorldX, WorldY);
-
     if (PlateauInf > 0.6f)
     {
         // Highland plains on top of plateaus
@@ -559,11 +594,14 @@ EBiomeType UVoxelTerrainGenerator::GetBiome(int32 WorldX, int32 WorldY) const
 
 float UVoxelTerrainGenerator::GetFeatureHeight(int32 WorldX, int32 WorldY) const
 {
-    // Get feature influences
-    float PlateauInf = GetPlateauInfluence(WorldX, WorldY);
-    float ValleyInf = GetValleyInfluence(WorldX, WorldY);
-    float CanyonInf = GetCanyonInfluence(WorldX, WorldY);
+    return GetFeatureHeightFromInfluences(
+        GetPlateauInfluence(WorldX, WorldY),
+        GetValleyInfluence(WorldX, WorldY),
+        GetCanyonInfluence(WorldX, WorldY));
+}
 
+float UVoxelTerrainGenerator::GetFeatureHeightFromInfluences(float PlateauInf, float ValleyInf, float CanyonInf) const
+{
     float FeatureHeight = 0.0f;
 
     // CHANGED: Plateau height multiplier increased from 1.0x to 2.0x
@@ -596,6 +634,16 @@ float UVoxelTerrainGenerator::GetTerrainHeight(int32 WorldX, int32 WorldY) const
 {
     if (!NoiseGenerator) return WorldSettings.BaseTerrainHeight;
 
+    return GetTerrainHeightFromInfluences(WorldX, WorldY,
+        GetPlateauInfluence(WorldX, WorldY),
+        GetValleyInfluence(WorldX, WorldY),
+        GetCanyonInfluence(WorldX, WorldY));
+}
+
+float UVoxelTerrainGenerator::GetTerrainHeightFromInfluences(int32 WorldX, int32 WorldY, float PlateauInf, float ValleyInf, float CanyonInf) const
+{
+    if (!NoiseGenerator) return WorldSettings.BaseTerrainHeight;
+
     // Get base terrain factors
     float Continentalness = GetContinentalness(WorldX, WorldY);
     float Erosion = GetErosion(WorldX, WorldY);
@@ -626,11 +674,10 @@ float UVoxelTerrainGenerator::GetTerrainHeight(int32 WorldX, int32 WorldY) const
     float FinalHeight = BaseHeight + ContinentHeight + TerrainVariation + DetailVariation;
 
     // Add feature height (plateaus, valleys)
-    float FeatureHeight = GetFeatureHeight(WorldX, WorldY);
+    float FeatureHeight = GetFeatureHeightFromInfluences(PlateauInf, ValleyInf, CanyonInf);
     FinalHeight += FeatureHeight;
 
     // Apply plateau flatness on top
-    float PlateauInf = GetPlateauInfluence(WorldX, WorldY);
     if (PlateauInf > 0.5f)
     {
         float Flatness = WorldSettings.BiomeSettings.PlateauFlatness;
@@ -772,22 +819,177 @@ float UVoxelTerrainGenerator::GetCaveDensity(int32 WorldX, int32 WorldY, int32 W
 {
     if (!WorldSettings.bGenerateCaves || !NoiseGenerator) return -1.0f;
 
-    float TerrainHeight = GetTerrainHeight(WorldX, WorldY);
-    float EntranceInfluence = GetCaveEntranceInfluence(WorldX, WorldY);
+    FVoxelColumnData Column;
+    GetColumnData(WorldX, WorldY, Column);
+    return GetCaveDensityFromColumn(Column, WorldX, WorldY, WorldZ);
+}
+
+float UVoxelTerrainGenerator::GetCaveNoise(int32 WorldX, int32 WorldY, int32 WorldZ) const
+{
+    float CaveFrequency = WorldSettings.NoiseFrequency * 3.0f;
+    float CaveNoise = NoiseGenerator->GetFractalNoise3D(
+        WorldX * CaveFrequency,
+        WorldY * CaveFrequency,
+        WorldZ * CaveFrequency,
+        3, 0.5f, 2.0f
+    );
+
+    float CaveNoise2 = NoiseGenerator->GetFractalNoise3D(
+        WorldX * CaveFrequency * 0.5f + 3000.0f,
+        WorldY * CaveFrequency * 0.5f + 3000.0f,
+        WorldZ * CaveFrequency * 0.5f + 3000.0f,
+        2, 0.5f, 2.0f
+    );
+
+    return (CaveNoise + CaveNoise2) * 0.5f;
+}
+
+void UVoxelTerrainGenerator::GetCaveNoiseLayerBatch(ECaveNoiseLayer Layer, const TArray<FIntVector>& Points, TArray<float>& OutNoise) const
+{
+    const int32 Num = Points.Num();
+    OutNoise.SetNumUninitialized(Num);
+    if (Num == 0) return;
+
+    // Coordinates are computed with the exact expressions used by GetCaveNoise so batched results match
+    const float CaveFrequency = WorldSettings.NoiseFrequency * 3.0f;
+    const bool bShape = Layer == ECaveNoiseLayer::Shape;
+
+    TArray<float> X, Y, Z;
+    X.SetNumUninitialized(Num);
+    Y.SetNumUninitialized(Num);
+    Z.SetNumUninitialized(Num);
+
+    for (int32 i = 0; i < Num; ++i)
+    {
+        const FIntVector& P = Points[i];
+        if (bShape)
+        {
+            X[i] = P.X * CaveFrequency * 0.5f + 3000.0f;
+            Y[i] = P.Y * CaveFrequency * 0.5f + 3000.0f;
+            Z[i] = P.Z * CaveFrequency * 0.5f + 3000.0f;
+        }
+        else
+        {
+            X[i] = P.X * CaveFrequency;
+            Y[i] = P.Y * CaveFrequency;
+            Z[i] = P.Z * CaveFrequency;
+        }
+    }
+
+    NoiseGenerator->GetFractalNoise3DBatch(X.GetData(), Y.GetData(), Z.GetData(), OutNoise.GetData(), Num, bShape ? 2 : 3, 0.5f, 2.0f);
+}
+
+int32 UVoxelTerrainGenerator::GetEffectiveSampleStep(int32 RequestedStep, int32 ChunkSize)
+{
+    int32 Step = RequestedStep >= 4 ? 4 : (RequestedStep >= 2 ? 2 : 1);
+    while (Step > 1 && ChunkSize % Step != 0)
+    {
+        Step /= 2;
+    }
+    return Step;
+}
+
+void UVoxelTerrainGenerator::SampleCaveNoiseLayer(ECaveNoiseLayer Layer, const FIntVector& WorldBase, int32 ChunkSize, int32 Step,
+    const TArray<FIntVector>& Points, TArray<float>& OutNoise) const
+{
+    if (Step <= 1)
+    {
+        GetCaveNoiseLayerBatch(Layer, Points, OutNoise);
+        return;
+    }
+
+    // Coarse lattice covering the chunk's density points plus one cell beyond each face (for apron points)
+    const int32 CoarseSize = ChunkSize / Step + 3;
+    auto CoarseIndex = [CoarseSize](int32 X, int32 Y, int32 Z)
+    {
+        return X + Y * CoarseSize + Z * CoarseSize * CoarseSize;
+    };
+
+    // Cell of a local coordinate in [-Step, ChunkSize+Step] - coarse index 0 sits one step before the chunk origin
+    auto GetCell = [Step, CoarseSize](int32 Local, int32& OutCell, float& OutFrac)
+    {
+        OutCell = FMath::Clamp((Local + Step) / Step, 0, CoarseSize - 2);
+        OutFrac = (float)(Local + Step - OutCell * Step) / (float)Step;
+    };
+
+    // Only evaluate coarse points that some requested point interpolates from
+    TBitArray<> Needed(false, CoarseSize * CoarseSize * CoarseSize);
+    for (const FIntVector& P : Points)
+    {
+        int32 CX, CY, CZ;
+        float FX, FY, FZ;
+        GetCell(P.X - WorldBase.X, CX, FX);
+        GetCell(P.Y - WorldBase.Y, CY, FY);
+        GetCell(P.Z - WorldBase.Z, CZ, FZ);
+
+        for (int32 Corner = 0; Corner < 8; ++Corner)
+        {
+            Needed[CoarseIndex(CX + (Corner & 1), CY + ((Corner >> 1) & 1), CZ + ((Corner >> 2) & 1))] = true;
+        }
+    }
+
+    TArray<FIntVector> CoarsePoints;
+    TArray<int32> CoarseIndices;
+    for (TConstSetBitIterator<> It(Needed); It; ++It)
+    {
+        const int32 Index = It.GetIndex();
+        const int32 X = Index % CoarseSize;
+        const int32 Y = (Index / CoarseSize) % CoarseSize;
+        const int32 Z = Index / (CoarseSize * CoarseSize);
+        CoarsePoints.Add(WorldBase + (FIntVector(X, Y, Z) - FIntVector(1)) * Step);
+        CoarseIndices.Add(Index);
+    }
+
+    TArray<float> CoarseValues;
+    GetCaveNoiseLayerBatch(Layer, CoarsePoints, CoarseValues);
+
+    TArray<float> Lattice;
+    Lattice.SetNumZeroed(CoarseSize * CoarseSize * CoarseSize);
+    for (int32 i = 0; i < CoarseIndices.Num(); ++i)
+    {
+        Lattice[CoarseIndices[i]] = CoarseValues[i];
+    }
+
+    // Trilinear upsampling
+    OutNoise.SetNumUninitialized(Points.Num());
+    for (int32 i = 0; i < Points.Num(); ++i)
+    {
+        const FIntVector& P = Points[i];
+        int32 CX, CY, CZ;
+        float FX, FY, FZ;
+        GetCell(P.X - WorldBase.X, CX, FX);
+        GetCell(P.Y - WorldBase.Y, CY, FY);
+        GetCell(P.Z - WorldBase.Z, CZ, FZ);
+
+        const float C00 = FMath::Lerp(Lattice[CoarseIndex(CX, CY, CZ)], Lattice[CoarseIndex(CX + 1, CY, CZ)], FX);
+        const float C10 = FMath::Lerp(Lattice[CoarseIndex(CX, CY + 1, CZ)], Lattice[CoarseIndex(CX + 1, CY + 1, CZ)], FX);
+        const float C01 = FMath::Lerp(Lattice[CoarseIndex(CX, CY, CZ + 1)], Lattice[CoarseIndex(CX + 1, CY, CZ + 1)], FX);
+        const float C11 = FMath::Lerp(Lattice[CoarseIndex(CX, CY + 1, CZ + 1)], Lattice[CoarseIndex(CX + 1, CY + 1, CZ + 1)], FX);
+
+        OutNoise[i] = FMath::Lerp(FMath::Lerp(C00, C10, FY), FMath::Lerp(C01, C11, FY), FZ);
+    }
+}
+
+float UVoxelTerrainGenerator::GetCaveDensityFromColumn(const FVoxelColumnData& Column, int32 WorldX, int32 WorldY, int32 WorldZ, const float* CaveNoise) const
+{
+    if (!WorldSettings.bGenerateCaves || !NoiseGenerator) return -1.0f;
+
+    const float TerrainHeight = Column.TerrainHeight;
+    const float EntranceInfluence = Column.EntranceInfluence;
 
     // ==========================================
     // Check entrance shaft and chamber first
     // ==========================================
     if (EntranceInfluence > 0.1f)
     {
-        float ShaftDensity = GetEntranceShaftDensity(WorldX, WorldY, WorldZ);
+        float ShaftDensity = GetEntranceShaftDensityFromColumn(Column, WorldX, WorldY, WorldZ);
         if (ShaftDensity > 0.0f)
         {
             return ShaftDensity;
         }
 
         // Check horizontal tunnels extending from chambers
-        float TunnelDensity = GetEntranceTunnelDensity(WorldX, WorldY, WorldZ);
+        float TunnelDensity = GetEntranceTunnelDensityFromColumn(Column, WorldX, WorldY, WorldZ);
         if (TunnelDensity > 0.0f)
         {
             return TunnelDensity;
@@ -809,31 +1011,15 @@ float UVoxelTerrainGenerator::GetCaveDensity(int32 WorldX, int32 WorldY, int32 W
     if (WorldZ > TerrainHeight - SurfaceMargin || WorldZ < 3) return -1.0f;
 
     // Reduce caves in plateau areas (solid rock)
-    float PlateauInf = GetPlateauInfluence(WorldX, WorldY);
-    if (PlateauInf > 0.7f) return -1.0f;
+    if (Column.PlateauInfluence > 0.7f) return -1.0f;
 
-    float CaveFrequency = WorldSettings.NoiseFrequency * 3.0f;
-    float CaveNoise = NoiseGenerator->GetFractalNoise3D(
-        WorldX * CaveFrequency,
-        WorldY * CaveFrequency,
-        WorldZ * CaveFrequency,
-        3, 0.5f, 2.0f
-    );
-
-    float CaveNoise2 = NoiseGenerator->GetFractalNoise3D(
-        WorldX * CaveFrequency * 0.5f + 3000.0f,
-        WorldY * CaveFrequency * 0.5f + 3000.0f,
-        WorldZ * CaveFrequency * 0.5f + 3000.0f,
-        2, 0.5f, 2.0f
-    );
-
-    float CombinedNoise = (CaveNoise + CaveNoise2) * 0.5f;
+    float CombinedNoise = CaveNoise ? *CaveNoise : GetCaveNoise(WorldX, WorldY, WorldZ);
 
     float DepthFactor = 1.0f - (float)(WorldZ) / TerrainHeight;
     float AdjustedThreshold = WorldSettings.CaveThreshold - DepthFactor * 0.1f;
 
     // More caves in valleys
-    float ValleyInf = GetValleyInfluence(WorldX, WorldY);
+    const float ValleyInf = Column.ValleyInfluence;
     if (ValleyInf > 0.3f)
     {
         AdjustedThreshold -= 0.1f * ValleyInf;
@@ -845,8 +1031,8 @@ float UVoxelTerrainGenerator::GetCaveDensity(int32 WorldX, int32 WorldY, int32 W
     // ==========================================
     if (EntranceInfluence > 0.05f)
     {
-        float ShaftTop, ShaftBottom, ChamberBottom;
-        GetShaftParameters(TerrainHeight, ShaftTop, ShaftBottom, ChamberBottom);
+        const float ShaftBottom = Column.ShaftBottom;
+        const float ChamberBottom = Column.ChamberBottom;
 
         // Strong boost throughout the entrance zone
         float EntranceBoost = EntranceInfluence * 0.35f;
@@ -873,20 +1059,36 @@ float UVoxelTerrainGenerator::GetCaveDensity(int32 WorldX, int32 WorldY, int32 W
 
 bool UVoxelTerrainGenerator::IsCave(int32 WorldX, int32 WorldY, int32 WorldZ) const
 {
+    FVoxelColumnData Column;
+    GetColumnData(WorldX, WorldY, Column);
+
     // Check entrance shaft first
-    if (IsInCaveEntrance(WorldX, WorldY, WorldZ))
+    if (IsInCaveEntranceFromColumn(Column, WorldZ))
     {
         return true;
     }
 
     // Check regular caves
-    return GetCaveDensity(WorldX, WorldY, WorldZ) > 0.0f;
+    return GetCaveDensityFromColumn(Column, WorldX, WorldY, WorldZ) > 0.0f;
 }
 
 float UVoxelTerrainGenerator::GetDensity(int32 WorldX, int32 WorldY, int32 WorldZ) const
 {
-    // Get terrain height at this XY position
-    float TerrainHeight = GetTerrainHeight(WorldX, WorldY);
+    FVoxelColumnData Column;
+    GetColumnData(WorldX, WorldY, Column);
+    return GetDensityFromColumn(Column, WorldX, WorldY, WorldZ);
+}
+
+float UVoxelTerrainGenerator::GetDensityFromColumn(const FVoxelColumnData& Column, int32 WorldX, int32 WorldY, int32 WorldZ) const
+{
+    TOptional<float> CaveDensity;
+    return EvaluateDensity(Column, WorldX, WorldY, WorldZ, CaveDensity);
+}
+
+float UVoxelTerrainGenerator::EvaluateDensity(const FVoxelColumnData& Column, int32 WorldX, int32 WorldY, int32 WorldZ, TOptional<float>& OutCaveDensity, const float* CaveNoise) const
+{
+    // Terrain height at this XY position
+    const float TerrainHeight = Column.TerrainHeight;
 
     // Basic terrain density (SDF: negative = solid, positive = air)
     float TerrainDensity = (float)WorldZ - TerrainHeight;
@@ -894,12 +1096,15 @@ float UVoxelTerrainGenerator::GetDensity(int32 WorldX, int32 WorldY, int32 World
     // =========================================
     // Cave Entrance Shaft and Chamber Carving
     // =========================================
-    float EntranceInfluence = GetCaveEntranceInfluence(WorldX, WorldY);
+    const float EntranceInfluence = Column.EntranceInfluence;
     if (EntranceInfluence > 0.1f)
     {
-        float ShaftDensity = GetEntranceShaftDensity(WorldX, WorldY, WorldZ);
+        float ShaftDensity = GetEntranceShaftDensityFromColumn(Column, WorldX, WorldY, WorldZ);
         if (ShaftDensity > 0.0f)
         {
+            // Cave density short-circuits to the shaft value in this case
+            OutCaveDensity = ShaftDensity;
+
             float BlendFactor = FMath::SmoothStep(0.0f, 0.5f, ShaftDensity);
             TerrainDensity = FMath::Lerp(TerrainDensity, ShaftDensity, BlendFactor);
 
@@ -908,9 +1113,11 @@ float UVoxelTerrainGenerator::GetDensity(int32 WorldX, int32 WorldY, int32 World
         }
 
         // Check horizontal tunnels
-        float TunnelDensity = GetEntranceTunnelDensity(WorldX, WorldY, WorldZ);
+        float TunnelDensity = GetEntranceTunnelDensityFromColumn(Column, WorldX, WorldY, WorldZ);
         if (TunnelDensity > 0.0f)
         {
+            OutCaveDensity = TunnelDensity;
+
             float BlendFactor = FMath::SmoothStep(0.0f, 0.5f, TunnelDensity);
             TerrainDensity = FMath::Lerp(TerrainDensity, TunnelDensity, BlendFactor);
 
@@ -936,7 +1143,8 @@ float UVoxelTerrainGenerator::GetDensity(int32 WorldX, int32 WorldY, int32 World
         WorldZ > 3 &&
         TerrainDensity < CaveDensityThreshold)
     {
-        float CaveDensity = GetCaveDensity(WorldX, WorldY, WorldZ);
+        float CaveDensity = GetCaveDensityFromColumn(Column, WorldX, WorldY, WorldZ, CaveNoise);
+        OutCaveDensity = CaveDensity;
 
         if (CaveDensity > 0.0f)
         {
@@ -994,16 +1202,15 @@ float UVoxelTerrainGenerator::GetDensity(int32 WorldX, int32 WorldY, int32 World
 // Material Selection
 // ==========================================
 
-EVoxelType UVoxelTerrainGenerator::GetPlateauMaterial(int32 WorldX, int32 WorldY, int32 WorldZ, float TerrainHeight) const
+EVoxelType UVoxelTerrainGenerator::GetPlateauMaterial(const FVoxelColumnData& Column, int32 WorldZ) const
 {
-    float DepthFromSurface = TerrainHeight - WorldZ;
-    float PlateauInf = GetPlateauInfluence(WorldX, WorldY);
+    float DepthFromSurface = Column.TerrainHeight - WorldZ;
+    float PlateauInf = Column.PlateauInfluence;
 
     // Plateau tops
     if (DepthFromSurface < 1 && PlateauInf > 0.7f)
     {
-        float Temperature = GetTemperature(WorldX, WorldY);
-        if (Temperature < 0.3f) return EVoxelType::Snow;
+        if (Column.Temperature < 0.3f) return EVoxelType::Snow;
         return EVoxelType::Grass; // Grassy plateau top
     }
 
@@ -1022,17 +1229,16 @@ EVoxelType UVoxelTerrainGenerator::GetPlateauMaterial(int32 WorldX, int32 WorldY
     return EVoxelType::Stone;
 }
 
-EVoxelType UVoxelTerrainGenerator::GetValleyMaterial(int32 WorldX, int32 WorldY, int32 WorldZ, float TerrainHeight) const
+EVoxelType UVoxelTerrainGenerator::GetValleyMaterial(const FVoxelColumnData& Column, int32 WorldZ) const
 {
-    float DepthFromSurface = TerrainHeight - WorldZ;
-    float ValleyInf = GetValleyInfluence(WorldX, WorldY);
+    float DepthFromSurface = Column.TerrainHeight - WorldZ;
+    float ValleyInf = Column.ValleyInfluence;
     float ValleyFloor = WorldSettings.BaseTerrainHeight - WorldSettings.BiomeSettings.ValleyDepth * ValleyInf;
 
     // Valley floor
     if (WorldZ < ValleyFloor + 3)
     {
-        float Moisture = GetMoisture(WorldX, WorldY);
-        if (Moisture > 0.6f) return EVoxelType::Clay; // Wet valley floor
+        if (Column.Moisture > 0.6f) return EVoxelType::Clay; // Wet valley floor
         return EVoxelType::Gravel; // Dry riverbed
     }
 
@@ -1045,23 +1251,21 @@ EVoxelType UVoxelTerrainGenerator::GetValleyMaterial(int32 WorldX, int32 WorldY,
     return EVoxelType::Stone;
 }
 
-EVoxelType UVoxelTerrainGenerator::GetSurfaceBlock(EBiomeType Biome, int32 WorldX, int32 WorldY, int32 WorldZ, float TerrainHeight) const
+EVoxelType UVoxelTerrainGenerator::GetSurfaceBlock(const FVoxelColumnData& Column, int32 WorldZ) const
 {
+    const float TerrainHeight = Column.TerrainHeight;
+    const EBiomeType Biome = Column.Biome;
     float DepthFromSurface = TerrainHeight - WorldZ;
 
     // Check for special terrain features first
-    float PlateauInf = GetPlateauInfluence(WorldX, WorldY);
-    float ValleyInf = GetValleyInfluence(WorldX, WorldY);
-    float CanyonInf = GetCanyonInfluence(WorldX, WorldY);
-
-    if (PlateauInf > 0.5f)
+    if (Column.PlateauInfluence > 0.5f)
     {
-        return GetPlateauMaterial(WorldX, WorldY, WorldZ, TerrainHeight);
+        return GetPlateauMaterial(Column, WorldZ);
     }
 
-    if (ValleyInf > 0.5f || CanyonInf > 0.5f)
+    if (Column.ValleyInfluence > 0.5f || Column.CanyonInfluence > 0.5f)
     {
-        return GetValleyMaterial(WorldX, WorldY, WorldZ, TerrainHeight);
+        return GetValleyMaterial(Column, WorldZ);
     }
 
     switch (Biome)
@@ -1160,9 +1364,22 @@ EVoxelType UVoxelTerrainGenerator::GetUndergroundBlock(int32 WorldZ, float Terra
 
 EVoxelType UVoxelTerrainGenerator::GetVoxelType(int32 WorldX, int32 WorldY, int32 WorldZ) const
 {
-    float TerrainHeight = GetTerrainHeight(WorldX, WorldY);
-    EBiomeType Biome = GetBiome(WorldX, WorldY);
-    float Density = GetDensity(WorldX, WorldY, WorldZ);
+    FVoxelColumnData Column;
+    GetColumnData(WorldX, WorldY, Column);
+    return GetVoxelTypeFromColumn(Column, WorldX, WorldY, WorldZ);
+}
+
+EVoxelType UVoxelTerrainGenerator::GetVoxelTypeFromColumn(const FVoxelColumnData& Column, int32 WorldX, int32 WorldY, int32 WorldZ) const
+{
+    TOptional<float> CaveDensity;
+    const float Density = EvaluateDensity(Column, WorldX, WorldY, WorldZ, CaveDensity);
+    return GetVoxelTypeFromDensity(Column, WorldX, WorldY, WorldZ, Density, CaveDensity);
+}
+
+EVoxelType UVoxelTerrainGenerator::GetVoxelTypeFromDensity(const FVoxelColumnData& Column, int32 WorldX, int32 WorldY, int32 WorldZ, float Density, const TOptional<float>& CaveDensity, const float* CaveNoise) const
+{
+    const float TerrainHeight = Column.TerrainHeight;
+    const EBiomeType Biome = Column.Biome;
 
     // If density > 0, it's air (or water)
     if (Density > 0.0f)
@@ -1172,7 +1389,7 @@ EVoxelType UVoxelTerrainGenerator::GetVoxelType(int32 WorldX, int32 WorldY, int3
 
         if (Biome == EBiomeType::DeepValley)
         {
-            float ValleyInf = GetValleyInfluence(WorldX, WorldY);
+            float ValleyInf = Column.ValleyInfluence;
             WaterLevel = WorldSettings.BaseTerrainHeight - WorldSettings.BiomeSettings.ValleyDepth * ValleyInf + 5;
         }
 
@@ -1183,8 +1400,14 @@ EVoxelType UVoxelTerrainGenerator::GetVoxelType(int32 WorldX, int32 WorldY, int3
         return EVoxelType::Air;
     }
 
-    // Check for caves (including entrance shafts)
-    if (IsCave(WorldX, WorldY, WorldZ))
+    // Check for caves (including entrance shafts) - reuse the cave density from the density pass when it was evaluated
+    if (IsInCaveEntranceFromColumn(Column, WorldZ))
+    {
+        return EVoxelType::Air;
+    }
+
+    const float EffectiveCaveDensity = CaveDensity.IsSet() ? CaveDensity.GetValue() : GetCaveDensityFromColumn(Column, WorldX, WorldY, WorldZ, CaveNoise);
+    if (EffectiveCaveDensity > 0.0f)
     {
         return EVoxelType::Air;
     }
@@ -1193,49 +1416,356 @@ EVoxelType UVoxelTerrainGenerator::GetVoxelType(int32 WorldX, int32 WorldY, int3
     float DepthFromSurface = TerrainHeight - WorldZ;
     if (DepthFromSurface < 5)
     {
-        return GetSurfaceBlock(Biome, WorldX, WorldY, WorldZ, TerrainHeight);
+        return GetSurfaceBlock(Column, WorldZ);
     }
 
     // Underground blocks
     return GetUndergroundBlock(WorldZ, TerrainHeight, Biome);
 }
 
+// ==========================================
+// Column (2D) Stage
+// ==========================================
+
+void UVoxelTerrainGenerator::GetColumnData(int32 WorldX, int32 WorldY, FVoxelColumnData& OutColumn) const
+{
+    // Climate is cheap next to the terrain terms, so the cache always holds complete columns
+    if (ColumnCache.Find(WorldX, WorldY, OutColumn))
+    {
+        return;
+    }
+
+    ComputeColumnData(WorldX, WorldY, OutColumn);
+    ColumnCache.Add(WorldX, WorldY, OutColumn);
+}
+
+void UVoxelTerrainGenerator::ComputeColumnData(int32 WorldX, int32 WorldY, FVoxelColumnData& OutColumn) const
+{
+    OutColumn.PlateauInfluence = GetPlateauInfluence(WorldX, WorldY);
+    OutColumn.ValleyInfluence = GetValleyInfluence(WorldX, WorldY);
+    OutColumn.CanyonInfluence = GetCanyonInfluence(WorldX, WorldY);
+    OutColumn.TerrainHeight = GetTerrainHeightFromInfluences(WorldX, WorldY,
+        OutColumn.PlateauInfluence, OutColumn.ValleyInfluence, OutColumn.CanyonInfluence);
+
+    OutColumn.EntranceInfluence = GetCaveEntranceInfluenceFromPlateau(WorldX, WorldY, OutColumn.PlateauInfluence);
+    GetShaftParameters(OutColumn.TerrainHeight, OutColumn.ShaftTop, OutColumn.ShaftBottom, OutColumn.ChamberBottom);
+
+    // Tunnel noise is only read around entrances - skip the warp lookups everywhere else
+    OutColumn.EntranceTunnelNoise = OutColumn.EntranceInfluence >= 0.05f ? GetEntranceTunnelNoise(WorldX, WorldY) : 0.0f;
+
+    OutColumn.Temperature = GetTemperature(WorldX, WorldY);
+    OutColumn.Moisture = GetMoisture(WorldX, WorldY);
+    OutColumn.Biome = GetBiomeFromFactors(WorldX, WorldY,
+        OutColumn.Temperature, OutColumn.Moisture, OutColumn.PlateauInfluence, OutColumn.ValleyInfluence);
+}
+
+void UVoxelTerrainGenerator::GenerateColumnData(int32 WorldBaseX, int32 WorldBaseY, int32 SizeX, int32 SizeY, TArray<FVoxelColumnData>& OutColumns, int32 Stride) const
+{
+    OutColumns.SetNumUninitialized(SizeX * SizeY);
+
+    for (int32 LocalY = 0; LocalY < SizeY; ++LocalY)
+    {
+        for (int32 LocalX = 0; LocalX < SizeX; ++LocalX)
+        {
+            GetColumnData(WorldBaseX + LocalX * Stride, WorldBaseY + LocalY * Stride, OutColumns[LocalX + LocalY * SizeX]);
+        }
+    }
+}
+
+bool UVoxelTerrainGenerator::GenerateChunkData(int32 WorldBaseX, int32 WorldBaseY, int32 WorldBaseZ, int32 ChunkSize,
+    TArray<float>& OutDensity, TArray<EVoxelType>& OutMaterials, const TAtomic<bool>* bCancelled, int32 Apron, int32 DataStep) const
+{
+    return GenerateChunkDataSampled(WorldBaseX, WorldBaseY, WorldBaseZ, ChunkSize,
+        WorldSettings.CaveNoiseSampleStep, WorldSettings.CaveShapeNoiseSampleStep,
+        OutDensity, OutMaterials, bCancelled, Apron, DataStep);
+}
+
+int32 UVoxelTerrainGenerator::GetEffectiveDataStep(int32 RequestedStep, int32 ChunkSize)
+{
+    int32 Step = 1;
+    while (Step * 2 <= RequestedStep && ChunkSize % (Step * 2) == 0)
+    {
+        Step *= 2;
+    }
+    return Step;
+}
+
+bool UVoxelTerrainGenerator::GenerateChunkDataSampled(int32 WorldBaseX, int32 WorldBaseY, int32 WorldBaseZ, int32 ChunkSize,
+    int32 CaveStep, int32 ShapeStep, TArray<float>& OutDensity, TArray<EVoxelType>& OutMaterials, const TAtomic<bool>* bCancelled, int32 Apron,
+    int32 DataStep) const
+{
+    // Reduced-resolution chunks only evaluate the lattice points their mesh step reads, DataStep voxels apart
+    DataStep = GetEffectiveDataStep(DataStep, ChunkSize);
+    const int32 CellsPerAxis = ChunkSize / DataStep;
+
+    // Density lattice spans local -Apron..CellsPerAxis+Apron; materials stay on the chunk's own CellsPerAxis^3 cells
+    Apron = FMath::Clamp(Apron, 0, 1);
+    const int32 DensitySize = CellsPerAxis + 1 + 2 * Apron;
+    const int32 OriginX = WorldBaseX - Apron * DataStep;
+    const int32 OriginY = WorldBaseY - Apron * DataStep;
+    const int32 OriginZ = WorldBaseZ - Apron * DataStep;
+
+    OutDensity.SetNumUninitialized(DensitySize * DensitySize * DensitySize);
+    OutMaterials.SetNumUninitialized(CellsPerAxis * CellsPerAxis * CellsPerAxis);
+
+    TArray<FVoxelColumnData> Columns;
+    GenerateColumnData(OriginX, OriginY, DensitySize, DensitySize, Columns, DataStep);
+
+    if (bCancelled && *bCancelled) return false;
+
+    // Batch the 3D cave noise for every lattice point the cave pass can reach
+    // (below the minimum surface margin, above bedrock and outside solid plateau cores)
+    TArray<float> CaveNoise;
+    TBitArray<> HasCaveNoise(false, OutDensity.Num());
+
+    if (WorldSettings.bGenerateCaves && NoiseGenerator)
+    {
+        TArray<FIntVector> CavePoints;
+        TArray<int32> CaveIndices;
+
+        for (int32 LocalZ = 0; LocalZ < DensitySize; ++LocalZ)
+        {
+            const int32 WorldZ = OriginZ + LocalZ * DataStep;
+            if (WorldZ < 3) continue;
+
+            for (int32 LocalY = 0; LocalY < DensitySize; ++LocalY)
+            {
+                for (int32 LocalX = 0; LocalX < DensitySize; ++LocalX)
+                {
+                    const FVoxelColumnData& Column = Columns[LocalX + LocalY * DensitySize];
+                    if (Column.PlateauInfluence > 0.7f || WorldZ > Column.TerrainHeight - 1.0f) continue;
+
+                    const int32 Index = LocalX + LocalY * DensitySize + LocalZ * DensitySize * DensitySize;
+                    CavePoints.Add(FIntVector(OriginX + LocalX * DataStep, OriginY + LocalY * DataStep, WorldZ));
+                    CaveIndices.Add(Index);
+                }
+            }
+        }
+
+        // Each layer is evaluated at full resolution or on a coarse lattice, per its configured sample step
+        // A coarse lattice no finer than the data lattice saves nothing - evaluate the points directly then
+        const FIntVector WorldBase(WorldBaseX, WorldBaseY, WorldBaseZ);
+        const int32 EffectiveCaveStep = GetEffectiveSampleStep(CaveStep, ChunkSize);
+        const int32 EffectiveShapeStep = GetEffectiveSampleStep(ShapeStep, ChunkSize);
+        TArray<float> DetailNoise, ShapeNoise;
+        SampleCaveNoiseLayer(ECaveNoiseLayer::Detail, WorldBase, ChunkSize, EffectiveCaveStep > DataStep ? EffectiveCaveStep : 1, CavePoints, DetailNoise);
+        SampleCaveNoiseLayer(ECaveNoiseLayer::Shape, WorldBase, ChunkSize, EffectiveShapeStep > DataStep ? EffectiveShapeStep : 1, CavePoints, ShapeNoise);
+
+        CaveNoise.SetNumUninitialized(OutDensity.Num());
+        for (int32 i = 0; i < CaveIndices.Num(); ++i)
+        {
+            CaveNoise[CaveIndices[i]] = (DetailNoise[i] + ShapeNoise[i]) * 0.5f;
+            HasCaveNoise[CaveIndices[i]] = true;
+        }
+    }
+
+    // Material cell of a padded lattice index, or -1 in the apron / on the far faces
+    auto GetMaterialLocal = [Apron, CellsPerAxis](int32 PaddedLocal)
+    {
+        const int32 Local = PaddedLocal - Apron;
+        return Local >= 0 && Local < CellsPerAxis ? Local : -1;
+    };
+
+    for (int32 LocalZ = 0; LocalZ < DensitySize; ++LocalZ)
+    {
+        if (bCancelled && *bCancelled) return false;
+
+        const int32 WorldZ = OriginZ + LocalZ * DataStep;
+        const int32 MaterialZ = GetMaterialLocal(LocalZ);
+
+        for (int32 LocalY = 0; LocalY < DensitySize; ++LocalY)
+        {
+            const int32 WorldY = OriginY + LocalY * DataStep;
+            const int32 MaterialY = GetMaterialLocal(LocalY);
+            const bool bMaterialRow = MaterialZ >= 0 && MaterialY >= 0;
+
+            for (int32 LocalX = 0; LocalX < DensitySize; ++LocalX)
+            {
+                const int32 WorldX = OriginX + LocalX * DataStep;
+                const FVoxelColumnData& Column = Columns[LocalX + LocalY * DensitySize];
+
+                const int32 DensityIndex = LocalX + LocalY * DensitySize + LocalZ * DensitySize * DensitySize;
+                const float* PointCaveNoise = HasCaveNoise[DensityIndex] ? &CaveNoise[DensityIndex] : nullptr;
+
+                TOptional<float> CaveDensity;
+                const float Density = EvaluateDensity(Column, WorldX, WorldY, WorldZ, CaveDensity, PointCaveNoise);
+                OutDensity[DensityIndex] = Density;
+
+                // Materials live on the inner CellsPerAxis^3 lattice and share this voxel's density and cave result
+                const int32 MaterialX = GetMaterialLocal(LocalX);
+                if (bMaterialRow && MaterialX >= 0)
+                {
+                    OutMaterials[MaterialX + MaterialY * CellsPerAxis + MaterialZ * CellsPerAxis * CellsPerAxis] =
+                        GetVoxelTypeFromDensity(Column, WorldX, WorldY, WorldZ, Density, CaveDensity, PointCaveNoise);
+                }
+            }
+        }
+    }
+
+    return true;
+}
+
+FVoxelSamplingErrorReport UVoxelTerrainGenerator::MeasureCaveSamplingError(const FChunkCoord& ChunkCoord, int32 CaveStep, int32 ShapeStep) const
+{
+    FVoxelSamplingErrorReport Report;
+
+    const int32 ChunkSize = WorldSettings.ChunkSize;
+    const int32 WorldBaseX = ChunkCoord.X * ChunkSize;
+    const int32 WorldBaseY = ChunkCoord.Y * ChunkSize;
+    const int32 WorldBaseZ = ChunkCoord.Z * ChunkSize;
+
+    TArray<float> ReferenceDensity, SampledDensity;
+    TArray<EVoxelType> ReferenceMaterials, SampledMaterials;
+    GenerateChunkDataSampled(WorldBaseX, WorldBaseY, WorldBaseZ, ChunkSize, 1, 1, ReferenceDensity, ReferenceMaterials, nullptr);
+    GenerateChunkDataSampled(WorldBaseX, WorldBaseY, WorldBaseZ, ChunkSize, CaveStep, ShapeStep, SampledDensity, SampledMaterials, nullptr);
+
+    double ErrorSum = 0.0;
+    for (int32 i = 0; i < ReferenceDensity.Num(); ++i)
+    {
+        const float Error = FMath::Abs(SampledDensity[i] - ReferenceDensity[i]);
+        Report.MaxDensityError = FMath::Max(Report.MaxDensityError, Error);
+        ErrorSum += Error;
+
+        if ((SampledDensity[i] > 0.0f) != (ReferenceDensity[i] > 0.0f))
+        {
+            Report.SignChanges++;
+        }
+    }
+
+    for (int32 i = 0; i < ReferenceMaterials.Num(); ++i)
+    {
+        if (SampledMaterials[i] != ReferenceMaterials[i])
+        {
+            Report.MaterialMismatches++;
+        }
+    }
+
+    Report.NumSamples = ReferenceDensity.Num();
+    Report.MeanDensityError = Report.NumSamples > 0 ? (float)(ErrorSum / Report.NumSamples) : 0.0f;
+    return Report;
+}
+
 // ==========================================
 // Optimization
 // ==========================================
 
 bool UVoxelTerrainGenerator::IsChunkLikelyEmpty(int32 ChunkX, int32 ChunkY, int32 ChunkZ, int32 ChunkSize) const
 {
-    // Quick check corners and center to see if chunk is likely all air or all solid
-    int32 WorldBaseX = ChunkX * ChunkSize;
-    int32 WorldBaseY = ChunkY * ChunkSize;
-    int32 WorldBaseZ = ChunkZ * ChunkSize;
-
-    // Sample points
-    const int32 SamplePoints[5][3] = {
-        {0, 0, 0},
-        {ChunkSize - 1, 0, 0},
-        {0, ChunkSize - 1, 0},
-        {ChunkSize - 1, ChunkSize - 1, 0},
-        {ChunkSize / 2, ChunkSize / 2, ChunkSize / 2}
-    };
+    return ClassifyChunk(ComputeColumnBounds(ChunkX, ChunkY, ChunkSize), ChunkZ, ChunkSize) == EVoxelChunkContent::Empty;
+}
+
+FVoxelColumnBounds UVoxelTerrainGenerator::ComputeColumnBounds(int32 ChunkX, int32 ChunkY, int32 ChunkSize) const
+{
+    FVoxelColumnBounds Bounds;
+    Bounds.MinHeight = MAX_flt;
+    Bounds.MaxHeight = -MAX_flt;
+    Bounds.bCaveFree = true;
 
-    int32 AirCount = 0;
-    int32 SolidCount = 0;
+    const int32 WorldBaseX = ChunkX * ChunkSize;
+    const int32 WorldBaseY = ChunkY * ChunkSize;
 
-    for (int32 i = 0; i < 5; ++i)
+    // Every density column of the chunk, including the shared +X/+Y boundary
+    FVoxelColumnData Column;
+    for (int32 LocalY = 0; LocalY <= ChunkSize; ++LocalY)
     {
-        float Height = GetTerrainHeight(
-            WorldBaseX + SamplePoints[i][0],
-            WorldBaseY + SamplePoints[i][1]
-        );
+        for (int32 LocalX = 0; LocalX <= ChunkSize; ++LocalX)
+        {
+            GetColumnData(WorldBaseX + LocalX, WorldBaseY + LocalY, Column);
+
+            Bounds.MinHeight = FMath::Min(Bounds.MinHeight, Column.TerrainHeight);
+            Bounds.MaxHeight = FMath::Max(Bounds.MaxHeight, Column.TerrainHeight);
+
+            // Plateau cores (> 0.7) reject caves outright and have no entrance influence
+            if (WorldSettings.bGenerateCaves && Column.PlateauInfluence <= 0.7f)
+            {
+                Bounds.bCaveFree = false;
+            }
+        }
+    }
 
-        int32 SampleZ = WorldBaseZ + SamplePoints[i][2];
+    return Bounds;
+}
+
+EVoxelChunkContent UVoxelTerrainGenerator::ClassifyChunk(const FVoxelColumnBounds& Bounds, int32 ChunkZ, int32 ChunkSize) const
+{
+    const int32 MinZ = ChunkZ * ChunkSize;
+    const int32 MaxZ = MinZ + ChunkSize;
+
+    // Above every column's surface (and clear of the bedrock blend) nothing can add solid:
+    // shafts, tunnels and caves only exist below the surface and only ever carve towards air
+    if (MinZ >= 3 && (float)MinZ > Bounds.MaxHeight)
+    {
+        return EVoxelChunkContent::Empty;
+    }
 
-        if (SampleZ > Height + 10) AirCount++;
-        else if (SampleZ < Height - 10) SolidCount++;
+    // Below every column's surface, density stays negative unless something can carve it
+    if ((float)MaxZ < Bounds.MinHeight && Bounds.bCaveFree)
+    {
+        return EVoxelChunkContent::Solid;
+    }
+
+    return EVoxelChunkContent::Surface;
+}
+
+// ==========================================
+// Column Cache
+// ==========================================
+
+void FVoxelColumnCache::Reset(int32 CapacityLog2)
+{
+    const int32 Capacity = 1 << FMath::Clamp(CapacityLog2, 4, 24);
+    Entries = MakeUnique<FEntry[]>(Capacity);
+    IndexMask = Capacity - 1;
+}
+
+bool FVoxelColumnCache::Find(int32 WorldX, int32 WorldY, FVoxelColumnData& OutColumn) const
+{
+    if (!Entries)
+    {
+        return false;
     }
 
-    // If all samples are air, chunk is likely empty
-    return AirCount >= 5;
+    const FEntry& Entry = GetEntry(WorldX, WorldY);
+
+    const uint32 SequenceBefore = Entry.Sequence.Load();
+    if (SequenceBefore == 0 || (SequenceBefore & 1) != 0)
+    {
+        return false;
+    }
+
+    // Optimistic copy - only trusted if no writer touched the entry meanwhile
+    const int32 EntryX = Entry.X;
+    const int32 EntryY = Entry.Y;
+    OutColumn = Entry.Data;
+
+    FPlatformMisc::MemoryBarrier();
+
+    return Entry.Sequence.Load() == SequenceBefore && EntryX == WorldX && EntryY == WorldY;
+}
+
+void FVoxelColumnCache::Add(int32 WorldX, int32 WorldY, const FVoxelColumnData& Column)
+{
+    if (!Entries)
+    {
+        return;
+    }
+
+    FEntry& Entry = GetEntry(WorldX, WorldY);
+
+    // Claim the entry by making its sequence odd - give up rather than wait if someone else holds it
+    uint32 Sequence = Entry.Sequence.Load();
+    if ((Sequence & 1) != 0 || !Entry.Sequence.CompareExchange(Sequence, Sequence + 1))
+    {
+        return;
+    }
+
+    Entry.X = WorldX;
+    Entry.Y = WorldY;
+    Entry.Data = Column;
+
+    FPlatformMisc::MemoryBarrier();
+
+    // Even again: readers may now trust the new contents (skip 0, which marks an empty entry)
+    const uint32 NextSequence = Sequence + 2;
+    Entry.Sequence = NextSequence != 0 ? NextSequence : 2;
 }
@@ -3,6 +3,7 @@
 #include "VoxelWorldManager.h"
 #include "VoxelChunk.h"
 #include "VoxelTerrainGenerator.h"
+#include "VoxelRegionStore.h"
 #include "VoxelWorldModule.h"
 #include "Async/Async.h"
 #include "Engine/World.h"
@@ -15,22 +16,72 @@
 // Async Task Implementation
 // ==========================================
 
+FChunkGenerationTask::FChunkGenerationTask(const TSharedRef<FVoxelGenerationJob, ESPMode::ThreadSafe>& InJob,
+    const TSharedRef<FVoxelCompletionQueues, ESPMode::ThreadSafe>& InCompletions, uint32 InEpoch)
+    : Job(InJob)
+    , Completions(InCompletions)
+    , Epoch(InEpoch)
+{
+}
+
 void FChunkGenerationTask::DoWork()
 {
-    // Check cancellation flag before doing any work
-    if (CancelFlag && *CancelFlag)
+    // Check cancellation flags before doing any work
+    if (!Completions->bCancelled && !Job->bCancelled)
     {
-        return;
+        Job->Execute();
+
+        // Straight into the completion queue - no game-thread task per job
+        FVoxelGenerationCompletion Completion;
+        Completion.Epoch = Epoch;
+        Completion.Handle = Job->Handle;
+        Completion.Job = Job;
+        Completions->Generation.Enqueue(MoveTemp(Completion));
     }
 
-    // Check if chunk is still valid
-    if (!Chunk || !IsValid(Chunk) || Chunk->IsPendingKillOrUnreachable())
+    // Counted down here rather than from a game-thread callback, so shutdown waits for the work itself
+    --Completions->NumActiveTasks;
+}
+
+FRegionSaveTask::FRegionSaveTask(const TSharedRef<FVoxelRegionStore, ESPMode::ThreadSafe>& InRegionStore,
+    const TSharedRef<FVoxelCompletionQueues, ESPMode::ThreadSafe>& InCompletions)
+    : RegionStore(InRegionStore)
+    , Completions(InCompletions)
+{
+}
+
+void FRegionSaveTask::DoWork()
+{
+    RegionStore->Flush();
+
+    Completions->bRegionSaveInFlight = false;
+    --Completions->NumActiveTasks;
+}
+
+FChunkMeshingTask::FChunkMeshingTask(const TSharedRef<FVoxelMeshingJob, ESPMode::ThreadSafe>& InJob, AVoxelChunk* InChunk,
+    const TSharedRef<FVoxelCompletionQueues, ESPMode::ThreadSafe>& InCompletions, uint32 InEpoch)
+    : Job(InJob)
+    , Chunk(InChunk)
+    , Completions(InCompletions)
+    , Epoch(InEpoch)
+{
+}
+
+void FChunkMeshingTask::DoWork()
+{
+    if (!Completions->bCancelled)
     {
-        return;
+        Job->Execute();
+
+        // Hand the result back - the chunk is only resolved on the game thread
+        FCompletedMeshingJob Completion;
+        Completion.Epoch = Epoch;
+        Completion.Chunk = Chunk;
+        Completion.Job = Job;
+        Completions->Meshing.Enqueue(MoveTemp(Completion));
     }
 
-    // Generate the voxel data
-    Chunk->GenerateVoxelData();
+    --Completions->NumActiveTasks;
 }
 
 // ==========================================
@@ -42,13 +93,15 @@ AVoxelWorldManager::AVoxelWorldManager()
     PrimaryActorTick.bCanEverTick = true;
     PrimaryActorTick.TickInterval = 0.0f; // Tick every frame
 
-    bCancelAsyncTasks = false;
 }
 
 AVoxelWorldManager::~AVoxelWorldManager()
 {
-    // Ensure async tasks are cancelled
-    bCancelAsyncTasks = true;
+    // Tasks still queued skip their work - running ones only touch the shared queues, never this actor
+    Completions->bCancelled = true;
+
+    // Destroyed without EndPlay (e.g. the editor preview actor) - untriggered events would strand their gate tasks
+    ReleaseGenerationNodes();
 }
 
 // ==========================================
@@ -68,7 +121,7 @@ void AVoxelWorldManager::BeginPlay()
     }
 
     // Reset cancellation flag
-    bCancelAsyncTasks = false;
+    Completions->bCancelled = false;
 
     // Auto-initialize if not done manually
     if (!bIsInitialized)
@@ -82,7 +135,7 @@ void AVoxelWorldManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
     UE_LOG(LogVoxelWorld, Log, TEXT("VoxelWorldManager EndPlay - cleaning up..."));
 
     // Signal all async tasks to cancel
-    bCancelAsyncTasks = true;
+    Completions->bCancelled = true;
 
     // Wait for async tasks to complete
     WaitForAsyncTasks();
@@ -98,14 +151,15 @@ void AVoxelWorldManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
 void AVoxelWorldManager::WaitForAsyncTasks()
 {
     // Wait for all async tasks to finish (with timeout)
+    // Giving up is safe - tasks hold the shared queues, the job and its generator, never the actor
     const float TimeoutSeconds = 5.0f;
     const float StartTime = FPlatformTime::Seconds();
 
-    while (ActiveAsyncTasks.Load() > 0)
+    while (Completions->NumActiveTasks.Load() > 0)
     {
         if (FPlatformTime::Seconds() - StartTime > TimeoutSeconds)
         {
-            UE_LOG(LogVoxelWorld, Warning, TEXT("Timeout waiting for async tasks to complete. %d tasks still running."), ActiveAsyncTasks.Load());
+            UE_LOG(LogVoxelWorld, Warning, TEXT("Timeout waiting for async tasks to complete. %d tasks still running."), Completions->NumActiveTasks.Load());
             break;
         }
 
@@ -199,10 +253,13 @@ void AVoxelWorldManager::InitializeEditorPreview()
     TerrainGenerator = NewObject<UVoxelTerrainGenerator>(this);
     TerrainGenerator->Initialize(WorldSettings);
 
+    // Preview edits are throwaway - never read or written
+    RegionStore.Reset();
+
     CurrentLoadCenter = WorldToChunkCoord(GetActorLocation());
     bIsInitialized = true;
     bIsEditorPreview = true;
-    bCancelAsyncTasks = false;
+    Completions->bCancelled = false;
 
     UpdateChunkLoading();
 }
@@ -219,7 +276,7 @@ void AVoxelWorldManager::RegenerateEditorPreview()
 
     UE_LOG(LogVoxelWorld, Log, TEXT("Regenerating editor preview..."));
 
-    bCancelAsyncTasks = true;
+    Completions->bCancelled = true;
     WaitForAsyncTasks();
 
     DestroyAllChunks();
@@ -228,7 +285,7 @@ void AVoxelWorldManager::RegenerateEditorPreview()
 
     if (bEnableEditorPreview)
     {
-        bCancelAsyncTasks = false;
+        Completions->bCancelled = false;
         InitializeEditorPreview();
     }
 #endif
@@ -239,7 +296,7 @@ void AVoxelWorldManager::ClearEditorPreview()
 #if WITH_EDITOR
     UE_LOG(LogVoxelWorld, Log, TEXT("Clearing editor preview..."));
 
-    bCancelAsyncTasks = true;
+    Completions->bCancelled = true;
     WaitForAsyncTasks();
 
     DestroyAllChunks();
@@ -274,10 +331,18 @@ void AVoxelWorldManager::InitializeWorld()
     TerrainGenerator = NewObject<UVoxelTerrainGenerator>(this);
     TerrainGenerator->Initialize(WorldSettings);
 
+    RegionStore.Reset();
+    if (WorldSettings.bPersistEdits)
+    {
+        const FString SaveDirectory = FVoxelRegionStore::GetSaveDirectory(WorldSettings.SaveSlotName, WorldSettings.Seed);
+        RegionStore = MakeShared<FVoxelRegionStore, ESPMode::ThreadSafe>(SaveDirectory, WorldSettings.ChunkSize);
+        UE_LOG(LogVoxelWorld, Log, TEXT("Persisting edits to %s"), *SaveDirectory);
+    }
+
     CurrentLoadCenter = FChunkCoord(0, 0, 0);
     bIsInitialized = true;
     bIsEditorPreview = false;
-    bCancelAsyncTasks = false;
+    Completions->bCancelled = false;
 
     UE_LOG(LogVoxelWorld, Log, TEXT("Voxel World initialized - Seed: %d, ChunkSize: %d, RenderDist: %d, LOD0: %d, LOD1: %d, LOD2: %d, CollisionDist: %d"),
         WorldSettings.Seed,
@@ -299,14 +364,22 @@ void AVoxelWorldManager::Tick(float DeltaTime)
 {
     Super::Tick(DeltaTime);
 
-    if (!bIsInitialized || bCancelAsyncTasks)
+    if (!bIsInitialized || Completions->bCancelled)
     {
         return;
     }
 
-    // Process queues
+    UpdateFrameBudget(DeltaTime);
+    DrainCompletionQueues();
+
+    // Process queues - each stage stops once its share of the frame is spent
+    ProcessRecycleQueue();
     ProcessGenerationQueue();
+    ProcessGenerationCompletions();
+    ResolveGenerationNodes();
     ProcessMeshBuildQueue();
+    ProcessMeshUploads();
+    ProcessCollisionUpdates();
 
     // Periodic LOD updates (not every frame)
     LODUpdateTimer += DeltaTime;
@@ -314,6 +387,10 @@ void AVoxelWorldManager::Tick(float DeltaTime)
     {
         LODUpdateTimer = 0.0f;
         UpdateChunkLODs();
+        UpdateChunkResidency();
+
+        // Catch saves queued while the last task was finishing
+        StartRegionSaveTask();
     }
 
     // Periodic collision updates
@@ -336,10 +413,31 @@ void AVoxelWorldManager::SetLoadCenter(const FVector& WorldPosition)
     if (NewCenter != CurrentLoadCenter)
     {
         CurrentLoadCenter = NewCenter;
+        bQueuePrioritiesDirty = true;
         UpdateChunkLoading();
     }
 }
 
+void AVoxelWorldManager::SetViewInfo(const FVector& ViewLocation, const FVector& ViewDirection, float FOVDegrees, const FVector& Velocity)
+{
+    ViewOrigin = ViewLocation;
+    ViewForward = ViewDirection.GetSafeNormal(UE_SMALL_NUMBER, FVector::ForwardVector);
+    ViewCosHalfFOV = FMath::Cos(FMath::DegreesToRadians(FMath::Clamp(FOVDegrees, 1.0f, 179.0f) * 0.5f));
+    ViewVelocity = Velocity;
+
+    // Rescoring walks both queues, so wait for a change that would visibly reorder them
+    const float ChunkWorldSize = WorldSettings.ChunkSize * WorldSettings.VoxelSize;
+    if (!bHasViewInfo
+        || FVector::DotProduct(ViewForward, ScoredViewForward) < ViewRescoreCosAngle
+        || FVector::DistSquared(ViewOrigin, ScoredViewOrigin) > FMath::Square(ChunkWorldSize * 0.5f)
+        || FVector::DistSquared(ViewVelocity, ScoredViewVelocity) > FMath::Square(ChunkWorldSize * 0.25f))
+    {
+        bQueuePrioritiesDirty = true;
+    }
+
+    bHasViewInfo = true;
+}
+
 FChunkCoord AVoxelWorldManager::WorldToChunkCoord(const FVector& WorldPosition) const
 {
     float ChunkWorldSize = WorldSettings.ChunkSize * WorldSettings.VoxelSize;
@@ -374,56 +472,213 @@ void AVoxelWorldManager::WorldToLocalVoxelCoord(const FVector& WorldPosition, FC
 
 void AVoxelWorldManager::UpdateChunkLoading()
 {
-    if (bCancelAsyncTasks)
+    if (Completions->bCancelled)
     {
         return;
     }
 
-    int32 RenderDist = GetEffectiveRenderDistance();
-    int32 HeightChunks = WorldSettings.WorldHeightChunks;
+    const int32 RenderDist = GetEffectiveRenderDistance();
+    const int32 HeightChunks = WorldSettings.WorldHeightChunks;
 
-    TSet<FChunkCoord> ChunksToKeep;
+    // A new radius or height changes every row of the disk - start over from an empty interest set
+    const bool bRebuild = InterestRadius != RenderDist || InterestHeight != HeightChunks;
+    if (bRebuild)
+    {
+        InterestRadius = RenderDist;
+        InterestHeight = HeightChunks;
+        InterestCenter = CurrentLoadCenter;
+
+        // Row half-widths of the disk DX^2 + DY^2 <= R^2, indexed by DY + R
+        InterestRowHalfWidths.SetNumUninitialized(2 * RenderDist + 1);
+        for (int32 DY = -RenderDist; DY <= RenderDist; ++DY)
+        {
+            int32 HalfWidth = FMath::FloorToInt(FMath::Sqrt(static_cast<float>(RenderDist * RenderDist - DY * DY)));
+            while (HalfWidth * HalfWidth + DY * DY > RenderDist * RenderDist) --HalfWidth;
+            while ((HalfWidth + 1) * (HalfWidth + 1) + DY * DY <= RenderDist * RenderDist) ++HalfWidth;
+            InterestRowHalfWidths[DY + RenderDist] = HalfWidth;
+        }
+
+        UnloadOutsideInterestSet();
+    }
+
+    const FChunkCoord OldCenter = InterestCenter;
+    InterestCenter = CurrentLoadCenter;
+
+    // Column span of a row inside the disk around a centre (empty if Min > Max)
+    auto GetRowSpan = [this](const FChunkCoord& Center, int32 Y, int32& OutMin, int32& OutMax)
+    {
+        const int32 DY = Y - Center.Y;
+        if (FMath::Abs(DY) > InterestRadius)
+        {
+            OutMin = 1;
+            OutMax = 0;
+            return;
+        }
+
+        const int32 HalfWidth = InterestRowHalfWidths[DY + InterestRadius];
+        OutMin = Center.X - HalfWidth;
+        OutMax = Center.X + HalfWidth;
+    };
 
-    // Determine which chunks should be loaded
-    for (int32 X = CurrentLoadCenter.X - RenderDist; X <= CurrentLoadCenter.X + RenderDist; ++X)
+    // Columns of span A not in span B - at most two runs
+    auto ForEachColumnOutside = [](int32 AMin, int32 AMax, int32 BMin, int32 BMax, TFunctionRef<void(int32)> Func)
     {
-        for (int32 Y = CurrentLoadCenter.Y - RenderDist; Y <= CurrentLoadCenter.Y + RenderDist; ++Y)
+        if (BMin > BMax)
         {
-            for (int32 Z = 0; Z < HeightChunks; ++Z)
+            for (int32 X = AMin; X <= AMax; ++X)
             {
-                FChunkCoord Coord(X, Y, Z);
-                float Distance = GetChunkDistanceFromCenter(Coord);
+                Func(X);
+            }
+            return;
+        }
 
-                if (Distance <= RenderDist)
-                {
-                    ChunksToKeep.Add(Coord);
+        for (int32 X = AMin; X <= FMath::Min(AMax, BMin - 1); ++X)
+        {
+            Func(X);
+        }
 
-                    // Queue for loading if not already loaded
-                    if (!LoadedChunks.Contains(Coord) && !ChunkGenerationQueue.Contains(Coord))
-                    {
-                        ChunkGenerationQueue.Add(Coord);
-                    }
+        for (int32 X = FMath::Max(AMin, BMax + 1); X <= AMax; ++X)
+        {
+            Func(X);
+        }
+    };
+
+    // Only the shells that differ between the old and new disk are visited - a one-chunk move touches O(R) columns
+    const int32 MinY = FMath::Min(OldCenter.Y, InterestCenter.Y) - InterestRadius;
+    const int32 MaxY = FMath::Max(OldCenter.Y, InterestCenter.Y) + InterestRadius;
+
+    for (int32 Y = MinY; Y <= MaxY; ++Y)
+    {
+        int32 OldMin, OldMax, NewMin, NewMax;
+        GetRowSpan(OldCenter, Y, OldMin, OldMax);
+        GetRowSpan(InterestCenter, Y, NewMin, NewMax);
+
+        // After a rebuild the old interest set is empty, so every column enters
+        if (bRebuild)
+        {
+            OldMin = 1;
+            OldMax = 0;
+        }
+
+        if (OldMin == NewMin && OldMax == NewMax)
+        {
+            continue;
+        }
+
+        ForEachColumnOutside(OldMin, OldMax, NewMin, NewMax, [this, Y](int32 X)
+        {
+            UnloadColumn(X, Y);
+        });
+
+        ForEachColumnOutside(NewMin, NewMax, OldMin, OldMax, [this, Y](int32 X)
+        {
+            for (int32 Z = 0; Z < InterestHeight; ++Z)
+            {
+                // Queue for loading if not already loaded (or skipped as having no surface) - the heap orders it
+                const FChunkCoord Coord(X, Y, Z);
+                if (!LoadedChunks.Contains(Coord) && !SkippedChunks.Contains(Coord) && !PendingGenerationJobs.Contains(Coord))
+                {
+                    EnqueueChunkGeneration(Coord);
                 }
             }
+        });
+    }
+}
+
+bool AVoxelWorldManager::IsInInterestSet(const FChunkCoord& ChunkCoord) const
+{
+    const int32 DX = ChunkCoord.X - InterestCenter.X;
+    const int32 DY = ChunkCoord.Y - InterestCenter.Y;
+    return InterestRadius >= 0 && ChunkCoord.Z >= 0 && ChunkCoord.Z < InterestHeight && DX * DX + DY * DY <= InterestRadius * InterestRadius;
+}
+
+void AVoxelWorldManager::UnloadColumn(int32 X, int32 Y)
+{
+    for (int32 Z = 0; Z < InterestHeight; ++Z)
+    {
+        const FChunkCoord Coord(X, Y, Z);
+
+        if (LoadedChunks.Contains(Coord))
+        {
+            // Actors go through the budgeted recycle stage
+            RecycleQueue.Add(Coord);
+        }
+        else
+        {
+            // Cancel generation that has not produced an actor yet
+            if (PendingGenerationJobs.Contains(Coord))
+            {
+                ReleaseChunkData(Coord);
+            }
+            ChunkGenerationQueue.Remove(Coord);
         }
+
+        SkippedChunks.Remove(Coord);
     }
 
-    // Sort generation queue by distance (load closest first)
-    SortQueueByDistance(ChunkGenerationQueue);
+    ColumnBoundsCache.Remove(FIntPoint(X, Y));
+}
 
-    // Unload/recycle chunks that are too far away
-    TArray<FChunkCoord> ChunksToUnload;
+void AVoxelWorldManager::UnloadOutsideInterestSet()
+{
     for (auto& Pair : LoadedChunks)
     {
-        if (!ChunksToKeep.Contains(Pair.Key))
+        if (!IsInInterestSet(Pair.Key))
         {
-            ChunksToUnload.Add(Pair.Key);
+            RecycleQueue.Add(Pair.Key);
         }
     }
 
-    for (const FChunkCoord& Coord : ChunksToUnload)
+    TArray<FChunkCoord> JobsToCancel;
+    for (const auto& Pair : PendingGenerationJobs)
     {
-        RecycleChunk(Coord);
+        if (!IsInInterestSet(Pair.Key))
+        {
+            JobsToCancel.Add(Pair.Key);
+        }
+    }
+
+    for (const FChunkCoord& Coord : JobsToCancel)
+    {
+        ReleaseChunkData(Coord);
+    }
+
+    for (auto It = SkippedChunks.CreateIterator(); It; ++It)
+    {
+        if (!IsInInterestSet(It->Key))
+        {
+            It.RemoveCurrent();
+        }
+    }
+
+    TArray<FChunkCoord> QueuedOutside;
+    ChunkGenerationQueue.ForEach([this, &QueuedOutside](const FChunkCoord& Coord)
+    {
+        if (!IsInInterestSet(Coord))
+        {
+            QueuedOutside.Add(Coord);
+        }
+    });
+
+    for (const FChunkCoord& Coord : QueuedOutside)
+    {
+        ChunkGenerationQueue.Remove(Coord);
+    }
+
+    for (auto It = ColumnBoundsCache.CreateIterator(); It; ++It)
+    {
+        if (!IsInInterestSet(FChunkCoord(It->Key.X, It->Key.Y, 0)))
+        {
+            It.RemoveCurrent();
+        }
+    }
+}
+
+void AVoxelWorldManager::EnqueueChunkGeneration(const FChunkCoord& ChunkCoord)
+{
+    if (!ChunkGenerationQueue.Contains(ChunkCoord))
+    {
+        ChunkGenerationQueue.Push(ChunkCoord, GetChunkPriority(ChunkCoord));
     }
 }
 
@@ -447,12 +702,67 @@ void AVoxelWorldManager::UpdateChunkLODs()
         {
             Pair.Value->SetLOD(NewLOD);
 
+            // Promoted past its reduced-resolution data - regenerate finer (the old mesh stays up meanwhile)
+            if (Pair.Value->InvalidateCoarseData())
+            {
+                EnqueueChunkGeneration(Pair.Key);
+            }
+
             // Add to mesh rebuild queue
-            if (!MeshBuildQueue.Contains(Pair.Value))
+            QueueChunkForRebuild(Pair.Value);
+        }
+    }
+
+    // Second pass once every LOD is settled - flag faces that touch a chunk at another LOD
+    // Edge and corner neighbours count too: they meet this chunk along the rim of the faces their offset points through
+    for (auto& Pair : LoadedChunks)
+    {
+        AVoxelChunk* Chunk = Pair.Value;
+        if (!Chunk || !IsValid(Chunk))
+        {
+            continue;
+        }
+
+        const int32 LOD = static_cast<int32>(Chunk->GetCurrentLOD());
+        uint8 NewMask = 0;
+        int32 NewLevels = 0;
+
+        for (int32 DZ = -1; DZ <= 1; ++DZ)
+        {
+            for (int32 DY = -1; DY <= 1; ++DY)
             {
-                MeshBuildQueue.Add(Pair.Value);
+                for (int32 DX = -1; DX <= 1; ++DX)
+                {
+                    if (DX == 0 && DY == 0 && DZ == 0) continue;
+
+                    const TObjectPtr<AVoxelChunk>* Neighbor = LoadedChunks.Find(FChunkCoord(Pair.Key.X + DX, Pair.Key.Y + DY, Pair.Key.Z + DZ));
+                    if (!Neighbor || !*Neighbor || !IsValid(*Neighbor))
+                    {
+                        continue;
+                    }
+
+                    const int32 NeighborLOD = static_cast<int32>((*Neighbor)->GetCurrentLOD());
+                    if (NeighborLOD == LOD)
+                    {
+                        continue;
+                    }
+
+                    // Face bits follow EVoxelChunkFace: negative side even, positive side odd
+                    if (DX != 0) NewMask |= 1 << (DX > 0 ? 1 : 0);
+                    if (DY != 0) NewMask |= 1 << (DY > 0 ? 3 : 2);
+                    if (DZ != 0) NewMask |= 1 << (DZ > 0 ? 5 : 4);
+
+                    NewLevels = FMath::Max(NewLevels, NeighborLOD - LOD);
+                }
             }
         }
+
+        if (Chunk->GetTransitionMask() != NewMask || Chunk->GetTransitionLevels() != NewLevels)
+        {
+            Chunk->SetTransitionMask(NewMask, static_cast<uint8>(NewLevels));
+
+            QueueChunkForRebuild(Chunk);
+        }
     }
 }
 
@@ -467,6 +777,9 @@ EVoxelLOD AVoxelWorldManager::GetLODForDistance(float Distance) const
 
 void AVoxelWorldManager::UpdateChunkCollisions()
 {
+    // Rebuilt from scratch - anything left from the last pass is found again if it still needs switching
+    CollisionUpdateQueue.Reset();
+
     for (auto& Pair : LoadedChunks)
     {
         if (!Pair.Value || !IsValid(Pair.Value))
@@ -479,15 +792,90 @@ void AVoxelWorldManager::UpdateChunkCollisions()
 
         if (Pair.Value->IsCollisionEnabled() != bShouldHaveCollision)
         {
-            Pair.Value->SetCollisionEnabled(bShouldHaveCollision);
+            CollisionUpdateQueue.Add(Pair.Key);
+        }
+    }
 
-            // Need to rebuild mesh with or without collision
-            if (Pair.Value->IsGenerated() && !MeshBuildQueue.Contains(Pair.Value))
-            {
-                MeshBuildQueue.Add(Pair.Value);
-            }
+    // Nearest first - collision under the player matters most
+    CollisionUpdateQueue.Sort([this](const FChunkCoord& A, const FChunkCoord& B)
+    {
+        return GetChunkDistanceFromCenter(A) < GetChunkDistanceFromCenter(B);
+    });
+}
+
+void AVoxelWorldManager::ProcessCollisionUpdates()
+{
+    const double StartTime = FPlatformTime::Seconds();
+    const double BudgetSeconds = GetStageBudgetSeconds(WorldSettings.CollisionBudgetMs);
+
+    int32 NumProcessed = 0;
+    int32 NumSwitched = 0;
+    while (NumProcessed < CollisionUpdateQueue.Num())
+    {
+        // Always make progress, then stop once the budget is spent
+        if (NumSwitched > 0 && FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+        {
+            break;
+        }
+
+        AVoxelChunk* Chunk = GetChunk(CollisionUpdateQueue[NumProcessed++]);
+        if (!Chunk || !IsValid(Chunk))
+        {
+            continue;
+        }
+
+        const bool bShouldHaveCollision = WorldSettings.LODSettings.ShouldHaveCollision(GetChunkDistanceFromCenter(Chunk->GetChunkCoord()));
+        if (Chunk->IsCollisionEnabled() == bShouldHaveCollision)
+        {
+            continue;
+        }
+
+        Chunk->SetCollisionEnabled(bShouldHaveCollision);
+
+        // Collision is cooked from the uploaded mesh - a mesh still on its way picks the new setting up itself
+        if (Chunk->NeedsMeshRebuild())
+        {
+            QueueChunkForRebuild(Chunk);
+        }
+        else if (Chunk->IsGenerated() && !Chunk->IsMeshTaskInFlight())
+        {
+            Chunk->UpdateMeshCollision();
         }
+        NumSwitched++;
+    }
+
+    CollisionUpdateQueue.RemoveAt(0, NumProcessed);
+    RecordStage(StreamingStats.Collision, StartTime, BudgetSeconds, NumSwitched, CollisionUpdateQueue.Num());
+}
+
+void AVoxelWorldManager::ProcessRecycleQueue()
+{
+    const double StartTime = FPlatformTime::Seconds();
+    const double BudgetSeconds = GetStageBudgetSeconds(WorldSettings.RecycleBudgetMs);
+
+    int32 NumProcessed = 0;
+    int32 NumRecycled = 0;
+    while (NumProcessed < RecycleQueue.Num())
+    {
+        if (NumRecycled > 0 && FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+        {
+            break;
+        }
+
+        // Came back into range before its turn (or already gone) - nothing to do
+        const FChunkCoord Coord = RecycleQueue[NumProcessed++];
+        if (IsInInterestSet(Coord) || !LoadedChunks.Contains(Coord))
+        {
+            continue;
+        }
+
+        RecycleChunk(Coord);
+        ChunkGenerationQueue.Remove(Coord);
+        NumRecycled++;
     }
+
+    RecycleQueue.RemoveAt(0, NumProcessed);
+    RecordStage(StreamingStats.Recycle, StartTime, BudgetSeconds, NumRecycled, RecycleQueue.Num());
 }
 
 // ==========================================
@@ -500,6 +888,54 @@ AVoxelChunk* AVoxelWorldManager::GetChunk(const FChunkCoord& ChunkCoord) const
     return ChunkPtr ? *ChunkPtr : nullptr;
 }
 
+AVoxelChunk* AVoxelWorldManager::GetOrMaterializeChunk(const FChunkCoord& ChunkCoord)
+{
+    if (AVoxelChunk* Chunk = GetChunk(ChunkCoord))
+    {
+        // Cold data comes back synchronously - the edit cannot wait for a worker
+        Chunk->EnsureDataResident();
+        return Chunk;
+    }
+
+    if (!SkippedChunks.Contains(ChunkCoord))
+    {
+        return nullptr;
+    }
+
+    AVoxelChunk* Chunk = CreateOrGetChunk(ChunkCoord);
+    if (!Chunk)
+    {
+        return nullptr;
+    }
+
+    SkippedChunks.Remove(ChunkCoord);
+
+    // Generate synchronously - the caller is about to edit the data
+    Chunk->GenerateVoxelData();
+
+    QueueChunkForRebuild(Chunk);
+
+    UE_LOG(LogVoxelWorld, Verbose, TEXT("Materialized skipped chunk %s for editing"), *ChunkCoord.ToString());
+
+    return Chunk;
+}
+
+EVoxelChunkContent AVoxelWorldManager::ClassifyChunkContent(const FChunkCoord& ChunkCoord, bool& bOutComputedBounds)
+{
+    bOutComputedBounds = false;
+
+    const FIntPoint ColumnKey(ChunkCoord.X, ChunkCoord.Y);
+    const FVoxelColumnBounds* Bounds = ColumnBoundsCache.Find(ColumnKey);
+
+    if (!Bounds)
+    {
+        Bounds = &ColumnBoundsCache.Add(ColumnKey, TerrainGenerator->ComputeColumnBounds(ChunkCoord.X, ChunkCoord.Y, WorldSettings.ChunkSize));
+        bOutComputedBounds = true;
+    }
+
+    return TerrainGenerator->ClassifyChunk(*Bounds, ChunkCoord.Z, WorldSettings.ChunkSize);
+}
+
 AVoxelChunk* AVoxelWorldManager::CreateOrGetChunk(const FChunkCoord& ChunkCoord)
 {
     // Check if already loaded
@@ -561,8 +997,9 @@ AVoxelChunk* AVoxelWorldManager::CreateOrGetChunk(const FChunkCoord& ChunkCoord)
 #endif
     }
 
-    // Initialize chunk
+    // Initialize chunk and point it at the coordinate's store entry (kept if data was generated before the actor)
     Chunk->InitializeChunk(ChunkCoord, WorldSettings, TerrainGenerator);
+    Chunk->AttachData(&ChunkStore, ChunkStore.FindOrAdd(ChunkCoord));
 
     // Set initial LOD and collision based on distance
     float Distance = GetChunkDistanceFromCenter(ChunkCoord);
@@ -613,6 +1050,7 @@ void AVoxelWorldManager::RecycleChunk(const FChunkCoord& ChunkCoord)
     }
 
     LoadedChunks.Remove(ChunkCoord);
+    ReleaseChunkData(ChunkCoord);
 }
 
 void AVoxelWorldManager::DestroyChunk(const FChunkCoord& ChunkCoord)
@@ -624,6 +1062,50 @@ void AVoxelWorldManager::DestroyChunk(const FChunkCoord& ChunkCoord)
         (*ChunkPtr)->Destroy();
     }
     LoadedChunks.Remove(ChunkCoord);
+    ReleaseChunkData(ChunkCoord);
+}
+
+void AVoxelWorldManager::ReleaseChunkData(const FChunkCoord& ChunkCoord)
+{
+    if (const TSharedRef<FVoxelGenerationJob, ESPMode::ThreadSafe>* Job = PendingGenerationJobs.Find(ChunkCoord))
+    {
+        (*Job)->bCancelled = true;
+        PendingGenerationJobs.Remove(ChunkCoord);
+    }
+
+    QueueChunkSave(ChunkCoord);
+    ChunkStore.Remove(ChunkCoord);
+    StartRegionSaveTask();
+}
+
+void AVoxelWorldManager::QueueChunkSave(const FChunkCoord& ChunkCoord)
+{
+    if (!RegionStore.IsValid())
+    {
+        return;
+    }
+
+    // The snapshot keeps the data (resident or cold) alive for the writer after the entry is gone
+    const FVoxelChunkHandle Handle = ChunkStore.Find(ChunkCoord);
+    const FVoxelChunkData* Data = ChunkStore.Get(Handle);
+    if (Data && Data->bUnsavedEdits)
+    {
+        RegionStore->SaveEdits(ChunkCoord, ChunkStore.Snapshot(Handle));
+    }
+}
+
+void AVoxelWorldManager::StartRegionSaveTask()
+{
+    if (!RegionStore.IsValid() || Completions->bRegionSaveInFlight || RegionStore->NumPendingSaves() == 0)
+    {
+        return;
+    }
+
+    Completions->bRegionSaveInFlight = true;
+    ++Completions->NumActiveTasks;
+
+    auto* Task = new FAutoDeleteAsyncTask<FRegionSaveTask>(RegionStore.ToSharedRef(), Completions);
+    Task->StartBackgroundTask();
 }
 
 void AVoxelWorldManager::DestroyAllChunks()
@@ -639,9 +1121,41 @@ void AVoxelWorldManager::DestroyAllChunks()
         }
     }
 
-    // Clear queues
+    // Clear queues - running generation jobs finish into nothing
+    for (auto& Pair : PendingGenerationJobs)
+    {
+        Pair.Value->bCancelled = true;
+    }
+    PendingGenerationJobs.Empty();
     ChunkGenerationQueue.Empty();
+
+    // Release every parked mesh build - the epoch bump below turns their gate tasks into no-ops
+    ReleaseGenerationNodes();
+
+    // Everything edited goes to disk before the data is dropped
+    if (RegionStore.IsValid())
+    {
+        for (auto& Pair : LoadedChunks)
+        {
+            QueueChunkSave(Pair.Key);
+        }
+        RegionStore->Flush();
+    }
+
     MeshBuildQueue.Empty();
+    CompletedMeshJobs.Empty();
+    CompletedGenerationJobs.Empty();
+
+    // Tasks still running push into the queues later - the new epoch marks their results as stale
+    Completions->Generation.Empty();
+    Completions->Meshing.Empty();
+    ++StreamingEpoch;
+
+    CollisionUpdateQueue.Empty();
+    RecycleQueue.Empty();
+    NumMeshTasksInFlight = 0;
+    SkippedChunks.Empty();
+    ColumnBoundsCache.Empty();
 
     // Destroy loaded chunks
     for (auto& Pair : LoadedChunks)
@@ -663,6 +1177,11 @@ void AVoxelWorldManager::DestroyAllChunks()
     }
     ChunkPool.Empty();
 
+    ChunkStore.Empty();
+
+    // Nothing is loaded any more - the next update rebuilds the interest set from scratch
+    InterestRadius = INDEX_NONE;
+
     UE_LOG(LogVoxelWorld, Log, TEXT("All chunks destroyed"));
 }
 
@@ -672,11 +1191,14 @@ void AVoxelWorldManager::DestroyAllChunks()
 
 void AVoxelWorldManager::ProcessGenerationQueue()
 {
-    if (bCancelAsyncTasks)
+    if (Completions->bCancelled)
     {
         return;
     }
 
+    const double StartTime = FPlatformTime::Seconds();
+    const double BudgetSeconds = GetStageBudgetSeconds(WorldSettings.GenerationBudgetMs);
+
     int32 ChunksProcessed = 0;
     int32 MaxChunksPerFrame = WorldSettings.ChunksPerFrame;
 
@@ -687,68 +1209,280 @@ void AVoxelWorldManager::ProcessGenerationQueue()
     }
 #endif
 
+    RescoreQueuesIfDirty();
+
     while (ChunkGenerationQueue.Num() > 0 && ChunksProcessed < MaxChunksPerFrame)
     {
-        if (bCancelAsyncTasks)
+        if (Completions->bCancelled)
         {
             break;
         }
 
-        FChunkCoord Coord = ChunkGenerationQueue[0];
-        ChunkGenerationQueue.RemoveAt(0);
+        // Always make progress, then stop once the budget is spent
+        if (ChunksProcessed > 0 && FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+        {
+            break;
+        }
 
-        AVoxelChunk* Chunk = CreateOrGetChunk(Coord);
+        const FChunkCoord Coord = ChunkGenerationQueue.Pop();
 
-        if (Chunk && !Chunk->IsGenerated())
+        // Left the render distance while waiting for its recycle
+        if (!IsInInterestSet(Coord))
         {
-#if WITH_EDITOR
-            // Always use synchronous generation in editor preview
-            if (bIsEditorPreview)
+            continue;
+        }
+
+        // Skip chunks that provably contain no surface - no actor, no voxel data, no mesh
+        // Saved chunks always generate, their edits may have carved into (or built on) the classified fill - so do chunks
+        // whose region table is still being read, until the lookup can answer
+        if (WorldSettings.bSkipEmptyChunks && TerrainGenerator && !(RegionStore.IsValid() && RegionStore->MayHaveChunk(Coord)))
+        {
+            bool bComputedBounds = false;
+            const EVoxelChunkContent Content = ClassifyChunkContent(Coord, bComputedBounds);
+
+            if (Content != EVoxelChunkContent::Surface)
             {
-                Chunk->GenerateVoxelData();
+                SkippedChunks.Add(Coord, FVoxelHomogeneousChunk(Content, Content == EVoxelChunkContent::Solid ? EVoxelType::Stone : EVoxelType::Air));
+
+                // Only a fresh column pass has a real cost; cached classifications are free
+                if (bComputedBounds)
+                {
+                    ChunksProcessed++;
+                }
+                continue;
             }
-            else
+        }
+
+        // Existing actors regenerate at their own LOD's lattice; new chunks get no actor until their data has a surface
+        AVoxelChunk* Chunk = GetChunk(Coord);
+        if (Chunk && Chunk->IsGenerated())
+        {
+            continue;
+        }
+
+        const int32 DataStep = Chunk ? Chunk->GetTargetDataStep()
+            : FVoxelChunkData::GetTargetDataStep(WorldSettings, GetLODForDistance(GetChunkDistanceFromCenter(Coord)));
+
+        StartGenerationJob(Coord, DataStep);
+        ChunksProcessed++;
+    }
+
+    RecordStage(StreamingStats.Generation, StartTime, BudgetSeconds, ChunksProcessed, ChunkGenerationQueue.Num());
+}
+
+void AVoxelWorldManager::StartGenerationJob(const FChunkCoord& ChunkCoord, int32 DataStep)
+{
+    TSharedRef<FVoxelGenerationJob, ESPMode::ThreadSafe> Job = MakeShared<FVoxelGenerationJob, ESPMode::ThreadSafe>();
+    Job->ChunkCoord = ChunkCoord;
+    Job->Handle = ChunkStore.FindOrAdd(ChunkCoord);
+    Job->ChunkSize = WorldSettings.ChunkSize;
+    Job->DataStep = DataStep;
+    Job->DensityFormat = WorldSettings.DensityFormat;
+    Job->Generator.Reset(TerrainGenerator);
+
+    // Only edited entries are shared with the job - the worker needs nothing else from the current data
+    const FVoxelChunkData* Existing = ChunkStore.Get(Job->Handle);
+    if (Existing && Existing->HasEdits())
+    {
+        Job->Source = ChunkStore.Snapshot(Job->Handle);
+    }
+    else if (!Existing || !Existing->HasData())
+    {
+        // First generation since the chunk was loaded - anything saved is read ahead of generating
+        Job->RegionStore = RegionStore;
+    }
+
+    // A newer request (e.g. a finer lattice after promotion) supersedes the one still running
+    if (const TSharedRef<FVoxelGenerationJob, ESPMode::ThreadSafe>* Previous = PendingGenerationJobs.Find(ChunkCoord))
+    {
+        (*Previous)->bCancelled = true;
+    }
+    PendingGenerationJobs.Add(ChunkCoord, Job);
+
+    // Always use synchronous generation in editor preview
+    bool bAsyncGeneration = WorldSettings.bAsyncGeneration;
+#if WITH_EDITOR
+    bAsyncGeneration &= !bIsEditorPreview;
 #endif
-            if (WorldSettings.bAsyncGeneration)
-            {
-                // Track active async task
-                ++ActiveAsyncTasks;
 
-                // Start async task
-                auto* Task = new FAutoDeleteAsyncTask<FChunkGenerationTask>(Chunk, &bCancelAsyncTasks);
-                Task->StartBackgroundTask();
+    if (bAsyncGeneration)
+    {
+        ++Completions->NumActiveTasks;
 
-                // Decrement counter when done (on game thread)
-                AsyncTask(ENamedThreads::GameThread, [this]()
-                {
-                    --ActiveAsyncTasks;
-                });
-            }
-            else
-            {
-                // Synchronous generation
-                Chunk->GenerateVoxelData();
-            }
+        auto* Task = new FAutoDeleteAsyncTask<FChunkGenerationTask>(Job, Completions, StreamingEpoch);
+        Task->StartBackgroundTask();
+    }
+    else
+    {
+        Job->Execute();
+        OnGenerationJobCompleted(Job);
+    }
+}
+
+void AVoxelWorldManager::OnGenerationJobCompleted(const TSharedRef<FVoxelGenerationJob, ESPMode::ThreadSafe>& Job)
+{
+    // The job stays pending until published, so nothing restarts it meanwhile
+    CompletedGenerationJobs.Add(Job);
+}
+
+void AVoxelWorldManager::DrainCompletionQueues()
+{
+    FVoxelGenerationCompletion Generated;
+    while (Completions->Generation.Dequeue(Generated))
+    {
+        if (Generated.Epoch == StreamingEpoch && Generated.Job.IsValid() && ChunkStore.IsValid(Generated.Handle))
+        {
+            OnGenerationJobCompleted(Generated.Job.ToSharedRef());
+        }
+    }
+
+    FCompletedMeshingJob Meshed;
+    while (Completions->Meshing.Dequeue(Meshed))
+    {
+        if (Meshed.Epoch == StreamingEpoch && Meshed.Job.IsValid())
+        {
+            OnMeshingJobCompleted(Meshed.Chunk, Meshed.Job.ToSharedRef());
+        }
+    }
+}
+
+void AVoxelWorldManager::ProcessGenerationCompletions()
+{
+    const double StartTime = FPlatformTime::Seconds();
+    const double BudgetSeconds = GetStageBudgetSeconds(WorldSettings.SpawnBudgetMs);
+
+    int32 NumProcessed = 0;
+    while (NumProcessed < CompletedGenerationJobs.Num() && !Completions->bCancelled)
+    {
+        if (NumProcessed > 0 && FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+        {
+            break;
+        }
+
+        // Copied out - the array may grow while publishing
+        const TSharedRef<FVoxelGenerationJob, ESPMode::ThreadSafe> Job = CompletedGenerationJobs[NumProcessed++];
+        PublishGenerationJob(Job);
+    }
+
+    CompletedGenerationJobs.RemoveAt(0, NumProcessed);
+    RecordStage(StreamingStats.Spawn, StartTime, BudgetSeconds, NumProcessed, CompletedGenerationJobs.Num());
+}
+
+void AVoxelWorldManager::PublishGenerationJob(const TSharedRef<FVoxelGenerationJob, ESPMode::ThreadSafe>& Job)
+{
+    // Superseded, unloaded or cancelled while running
+    const TSharedRef<FVoxelGenerationJob, ESPMode::ThreadSafe>* Pending = PendingGenerationJobs.Find(Job->ChunkCoord);
+    if (!Pending || *Pending != Job)
+    {
+        return;
+    }
+
+    PendingGenerationJobs.Remove(Job->ChunkCoord);
+
+    if (Completions->bCancelled || !Job->Result.IsValid() || !ChunkStore.IsValid(Job->Handle))
+    {
+        return;
+    }
+
+    // The result carries the edits the job started from - drop it if the entry was edited since
+    // (an edit made while the job ran already brought the data back at full resolution)
+    const FVoxelChunkData* Current = ChunkStore.Get(Job->Handle);
+    if (Current && Current != Job->Source.Get() && Current->HasEdits())
+    {
+        return;
+    }
+
+    AVoxelChunk* Chunk = GetChunk(Job->ChunkCoord);
+    if (!Chunk)
+    {
+        // Nothing to render - keep just the fill value, the data never reaches an actor
+        FVoxelHomogeneousChunk Fill;
+        if (WorldSettings.bSkipEmptyChunks && Job->Result->GetHomogeneousFill(Fill))
+        {
+            ChunkStore.Remove(Job->ChunkCoord);
+            SkippedChunks.Add(Job->ChunkCoord, Fill);
+            return;
+        }
+    }
+
+    ChunkStore.SetData(Job->Handle, Job->Result.ToSharedRef());
 
-            // Add to mesh build queue
-            if (!MeshBuildQueue.Contains(Chunk))
+    if (!Chunk)
+    {
+        Chunk = CreateOrGetChunk(Job->ChunkCoord);
+        if (!Chunk)
+        {
+            ChunkStore.Remove(Job->ChunkCoord);
+            return;
+        }
+    }
+
+    Chunk->NotifyDataGenerated();
+
+    QueueChunkForRebuild(Chunk);
+
+    UE_LOG(LogVoxelWorld, VeryVerbose, TEXT("Published generated chunk %s in %.2f ms"), *Job->ChunkCoord.ToString(), Job->BuildTimeMs);
+}
+
+void AVoxelWorldManager::UpdateChunkResidency()
+{
+    if (WorldSettings.DataUnloadDistance <= 0)
+    {
+        return;
+    }
+
+    for (auto& Pair : LoadedChunks)
+    {
+        AVoxelChunk* Chunk = Pair.Value;
+        if (!Chunk || !IsValid(Chunk) || !Chunk->IsGenerated())
+        {
+            continue;
+        }
+
+        const bool bCold = GetChunkDistanceFromCenter(Pair.Key) > WorldSettings.DataUnloadDistance;
+
+        if (!bCold)
+        {
+            // Back in range - have the data ready before anything needs it
+            if (!Chunk->HasVoxelData())
             {
-                MeshBuildQueue.Add(Chunk);
+                RequestDataRestore(Chunk);
             }
-            ChunksProcessed++;
+            continue;
         }
+
+        // Keep data that a mesh build is about to read or a task is still sharing
+        if (!Chunk->HasVoxelData() || Chunk->NeedsMeshRebuild() || Chunk->IsMeshTaskInFlight() || PendingGenerationJobs.Contains(Pair.Key))
+        {
+            continue;
+        }
+
+        Chunk->UnloadVoxelData();
+    }
+}
+
+void AVoxelWorldManager::RequestDataRestore(AVoxelChunk* Chunk)
+{
+    const FChunkCoord Coord = Chunk->GetChunkCoord();
+    if (PendingGenerationJobs.Contains(Coord))
+    {
+        return;
     }
+
+    StartGenerationJob(Coord, Chunk->GetTargetDataStep());
 }
 
 void AVoxelWorldManager::ProcessMeshBuildQueue()
 {
-    if (bCancelAsyncTasks)
+    if (Completions->bCancelled)
     {
         return;
     }
 
+    const double StartTime = FPlatformTime::Seconds();
+    const double BudgetSeconds = GetStageBudgetSeconds(WorldSettings.MeshBuildBudgetMs);
+
     int32 MeshesBuilt = 0;
-    TArray<AVoxelChunk*> ChunksToRequeue;
 
     int32 MaxMeshesPerFrame = WorldSettings.MeshBuildsPerFrame;
 
@@ -759,45 +1493,110 @@ void AVoxelWorldManager::ProcessMeshBuildQueue()
     }
 #endif
 
+    // Editor preview meshes synchronously so it never leaves tasks behind
+    bool bAsyncMeshing = WorldSettings.bAsyncMeshing;
+#if WITH_EDITOR
+    bAsyncMeshing &= !bIsEditorPreview;
+#endif
+
+    RescoreQueuesIfDirty();
+
     while (MeshBuildQueue.Num() > 0 && MeshesBuilt < MaxMeshesPerFrame)
     {
-        if (bCancelAsyncTasks)
+        if (Completions->bCancelled)
+        {
+            break;
+        }
+
+        if (MeshesBuilt > 0 && FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
         {
             break;
         }
 
-        AVoxelChunk* Chunk = MeshBuildQueue[0];
-        MeshBuildQueue.RemoveAt(0);
+        AVoxelChunk* Chunk = MeshBuildQueue.Pop();
 
-        if (!Chunk || !IsValid(Chunk) || Chunk->IsPendingKillOrUnreachable())
+        // Chunks waiting to be recycled are not worth a mesh
+        if (!Chunk || !IsValid(Chunk) || Chunk->IsPendingKillOrUnreachable() || !IsInInterestSet(Chunk->GetChunkCoord()))
         {
             continue;
         }
 
-        // If chunk isn't generated yet (async still running), re-queue it
+        // Not generated yet - wait for its own generation (publishing queues it again anyway)
         if (!Chunk->IsGenerated())
         {
-            ChunksToRequeue.Add(Chunk);
+            DeferMeshUntilGenerated(Chunk);
+            continue;
+        }
+
+        // Generated without a surface - keep only the fill value and free the actor for the next load
+        if (WorldSettings.bSkipEmptyChunks && TryDemoteHomogeneousChunk(Chunk))
+        {
             continue;
         }
 
         if (Chunk->NeedsMeshRebuild())
         {
-            // Update neighbors before building mesh
+            // Cold data is restored on a worker first - the old mesh stays up meanwhile
+            if (!Chunk->HasVoxelData())
+            {
+                RequestDataRestore(Chunk);
+                DeferMeshUntilGenerated(Chunk);
+                continue;
+            }
+
+            // Let the in-flight task report back first so results are applied in order - its upload requeues the chunk
+            if (Chunk->IsMeshTaskInFlight())
+            {
+                continue;
+            }
+
+            // Sample only generated neighbours, so the apron holds their data (and edits) rather than a stand-in
+            if (DeferMeshUntilGenerated(Chunk))
+            {
+                continue;
+            }
+
+            // Update neighbors and apron before building mesh
             UpdateChunkNeighbors(Chunk);
-            Chunk->BuildMesh();
+            SyncChunkApron(Chunk);
+
+            if (bAsyncMeshing)
+            {
+                StartMeshingTask(Chunk);
+            }
+            else
+            {
+                Chunk->BuildMesh();
+            }
             MeshesBuilt++;
         }
     }
 
-    // Re-add chunks that weren't ready yet
-    for (AVoxelChunk* Chunk : ChunksToRequeue)
+    RecordStage(StreamingStats.MeshBuild, StartTime, BudgetSeconds, MeshesBuilt, MeshBuildQueue.Num());
+}
+
+bool AVoxelWorldManager::TryDemoteHomogeneousChunk(AVoxelChunk* Chunk)
+{
+    // A stale result would otherwise arrive for a chunk that no longer exists
+    if (Chunk->IsMeshTaskInFlight())
+    {
+        return false;
+    }
+
+    FVoxelHomogeneousChunk Fill;
+    if (!Chunk->GetHomogeneousFill(Fill))
     {
-        if (Chunk && IsValid(Chunk) && !MeshBuildQueue.Contains(Chunk))
-        {
-            MeshBuildQueue.Add(Chunk);
-        }
+        return false;
     }
+
+    const FChunkCoord Coord = Chunk->GetChunkCoord();
+    RecycleChunk(Coord);
+    SkippedChunks.Add(Coord, Fill);
+
+    UE_LOG(LogVoxelWorld, Verbose, TEXT("Demoted chunk %s to a homogeneous %s fill"), *Coord.ToString(),
+        Fill.Content == EVoxelChunkContent::Solid ? TEXT("solid") : TEXT("empty"));
+
+    return true;
 }
 
 void AVoxelWorldManager::UpdateChunkNeighbors(AVoxelChunk* Chunk)
@@ -820,6 +1619,271 @@ void AVoxelWorldManager::UpdateChunkNeighbors(AVoxelChunk* Chunk)
 // Distance Calculations
 // ==========================================
 
+void AVoxelWorldManager::StartMeshingTask(AVoxelChunk* Chunk)
+{
+    const uint32 TaskId = NextMeshTaskId++;
+    if (NextMeshTaskId == 0)
+    {
+        NextMeshTaskId = 1;
+    }
+
+    TSharedRef<FVoxelMeshingJob, ESPMode::ThreadSafe> Job = Chunk->CreateMeshingJob(TaskId);
+
+    ++Completions->NumActiveTasks;
+    ++NumMeshTasksInFlight;
+
+    auto* Task = new FAutoDeleteAsyncTask<FChunkMeshingTask>(Job, Chunk, Completions, StreamingEpoch);
+    Task->StartBackgroundTask();
+}
+
+bool AVoxelWorldManager::HasOutstandingGeneration(const FChunkCoord& ChunkCoord) const
+{
+    return PendingGenerationJobs.Contains(ChunkCoord) || ChunkGenerationQueue.Contains(ChunkCoord);
+}
+
+bool AVoxelWorldManager::DeferMeshUntilGenerated(AVoxelChunk* Chunk)
+{
+    const FChunkCoord Coord = Chunk->GetChunkCoord();
+
+    // Already parked - its gate task requeues it
+    if (ChunksAwaitingGeneration.Contains(Coord))
+    {
+        return true;
+    }
+
+    // The chunk itself, then the face neighbours its apron samples
+    static const FIntVector Dependencies[] =
+    {
+        FIntVector(0, 0, 0),
+        FIntVector(1, 0, 0), FIntVector(-1, 0, 0),
+        FIntVector(0, 1, 0), FIntVector(0, -1, 0),
+        FIntVector(0, 0, 1), FIntVector(0, 0, -1)
+    };
+
+    TArray<UE::Tasks::FTaskEvent, TInlineAllocator<7>> Prerequisites;
+    for (const FIntVector& Offset : Dependencies)
+    {
+        const FChunkCoord Dependency(Coord.X + Offset.X, Coord.Y + Offset.Y, Coord.Z + Offset.Z);
+        if (!HasOutstandingGeneration(Dependency))
+        {
+            continue;
+        }
+
+        UE::Tasks::FTaskEvent* Node = GenerationNodes.Find(Dependency);
+        if (!Node)
+        {
+            Node = &GenerationNodes.Add(Dependency, UE::Tasks::FTaskEvent(TEXT("VoxelChunkGenerated")));
+        }
+        Prerequisites.Add(*Node);
+    }
+
+    if (Prerequisites.Num() == 0)
+    {
+        return false;
+    }
+
+    ChunksAwaitingGeneration.Add(Coord);
+
+    // Runs on the game thread once every prerequisite has triggered
+    UE::Tasks::Launch(TEXT("VoxelMeshGate"), [Manager = TWeakObjectPtr<AVoxelWorldManager>(this), Coord, Epoch = StreamingEpoch]()
+    {
+        if (AVoxelWorldManager* WorldManager = Manager.Get())
+        {
+            WorldManager->OnMeshPrerequisitesMet(Coord, Epoch);
+        }
+    }, Prerequisites, UE::Tasks::ETaskPriority::Normal, UE::Tasks::EExtendedTaskPriority::GameThreadNormalPri);
+
+    return true;
+}
+
+void AVoxelWorldManager::ResolveGenerationNodes()
+{
+    for (auto It = GenerationNodes.CreateIterator(); It; ++It)
+    {
+        if (!HasOutstandingGeneration(It->Key))
+        {
+            It->Value.Trigger();
+            It.RemoveCurrent();
+        }
+    }
+}
+
+void AVoxelWorldManager::ReleaseGenerationNodes()
+{
+    for (auto& Pair : GenerationNodes)
+    {
+        Pair.Value.Trigger();
+    }
+    GenerationNodes.Empty();
+    ChunksAwaitingGeneration.Empty();
+}
+
+void AVoxelWorldManager::OnMeshPrerequisitesMet(const FChunkCoord& ChunkCoord, uint32 Epoch)
+{
+    // Parked before a rebuild - the coordinate may have been parked again since, by a gate that is still waiting
+    if (Epoch != StreamingEpoch)
+    {
+        return;
+    }
+
+    ChunksAwaitingGeneration.Remove(ChunkCoord);
+
+    if (Completions->bCancelled)
+    {
+        return;
+    }
+
+    // Left range (or was demoted) while waiting - nothing to build
+    AVoxelChunk* Chunk = GetChunk(ChunkCoord);
+    if (!Chunk || !IsValid(Chunk) || Chunk->IsPendingKillOrUnreachable() || !IsInInterestSet(ChunkCoord))
+    {
+        return;
+    }
+
+    QueueChunkForRebuild(Chunk);
+}
+
+void AVoxelWorldManager::OnMeshingJobCompleted(const TWeakObjectPtr<AVoxelChunk>& Chunk, const TSharedRef<FVoxelMeshingJob, ESPMode::ThreadSafe>& Job)
+{
+    NumMeshTasksInFlight = FMath::Max(0, NumMeshTasksInFlight - 1);
+
+    if (Completions->bCancelled)
+    {
+        return;
+    }
+
+    FCompletedMeshingJob& Completed = CompletedMeshJobs.AddDefaulted_GetRef();
+    Completed.Chunk = Chunk;
+    Completed.Job = Job;
+}
+
+void AVoxelWorldManager::ProcessMeshUploads()
+{
+    if (Completions->bCancelled)
+    {
+        return;
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+    const double BudgetSeconds = GetStageBudgetSeconds(WorldSettings.MeshUploadBudgetMs);
+
+    int32 NumProcessed = 0;
+    while (NumProcessed < CompletedMeshJobs.Num())
+    {
+        // Always make progress, then stop once the budget is spent
+        if (NumProcessed > 0 && FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+        {
+            break;
+        }
+
+        FCompletedMeshingJob& Completed = CompletedMeshJobs[NumProcessed++];
+        AVoxelChunk* Chunk = Completed.Chunk.Get();
+
+        if (!Chunk || Chunk->IsPendingKillOrUnreachable())
+        {
+            continue;
+        }
+
+        // Stale results are dropped, and a chunk dirtied while its task ran was left off the queue - mesh it again from current data
+        Chunk->ApplyMeshingJob(*Completed.Job);
+        if (Chunk->NeedsMeshRebuild())
+        {
+            QueueChunkForRebuild(Chunk);
+        }
+    }
+
+    CompletedMeshJobs.RemoveAt(0, NumProcessed);
+    RecordStage(StreamingStats.MeshUpload, StartTime, BudgetSeconds, NumProcessed, CompletedMeshJobs.Num());
+}
+
+void AVoxelWorldManager::UpdateFrameBudget(float DeltaTime)
+{
+    // Clamped so a single hitch (level load, breakpoint) does not collapse the budgets
+    const float FrameTimeMs = FMath::Min(DeltaTime * 1000.0f, 250.0f);
+    SmoothedFrameTimeMs = SmoothedFrameTimeMs > 0.0f ? FMath::Lerp(SmoothedFrameTimeMs, FrameTimeMs, 0.1f) : FrameTimeMs;
+
+    if (!WorldSettings.bAdaptiveBudgets)
+    {
+        BudgetScale = 1.0f;
+    }
+    else
+    {
+        const float TargetFrameTimeMs = 1000.0f / FMath::Max(WorldSettings.TargetFrameRate, 1.0f);
+        const bool bHasBacklog = ChunkGenerationQueue.Num() > 0 || CompletedGenerationJobs.Num() > 0 || MeshBuildQueue.Num() > 0
+            || CompletedMeshJobs.Num() > 0 || CollisionUpdateQueue.Num() > 0 || RecycleQueue.Num() > 0;
+
+        // Back off quickly when over target, grow slowly while work is waiting and there is headroom
+        if (SmoothedFrameTimeMs > TargetFrameTimeMs * 1.05f)
+        {
+            BudgetScale *= 0.9f;
+        }
+        else if (bHasBacklog && SmoothedFrameTimeMs < TargetFrameTimeMs * 0.9f)
+        {
+            BudgetScale *= 1.02f;
+        }
+
+        BudgetScale = FMath::Clamp(BudgetScale, MinBudgetScale, MaxBudgetScale);
+    }
+
+    StreamingStats.FrameTimeMs = SmoothedFrameTimeMs;
+    StreamingStats.BudgetScale = BudgetScale;
+}
+
+double AVoxelWorldManager::GetStageBudgetSeconds(float BudgetMs) const
+{
+    float ScaledMs = BudgetMs * BudgetScale;
+
+#if WITH_EDITOR
+    if (bIsEditorPreview)
+    {
+        ScaledMs = FMath::Max(ScaledMs, EditorPreviewBudgetMs);
+    }
+#endif
+
+    return ScaledMs / 1000.0;
+}
+
+void AVoxelWorldManager::RecordStage(FVoxelStageStats& Stats, double StartTime, double BudgetSeconds, int32 Processed, int32 Remaining)
+{
+    Stats.BudgetMs = static_cast<float>(BudgetSeconds * 1000.0);
+    Stats.UsedMs = static_cast<float>((FPlatformTime::Seconds() - StartTime) * 1000.0);
+    Stats.Processed = Processed;
+    Stats.Remaining = Remaining;
+}
+
+void AVoxelWorldManager::SyncChunkApron(AVoxelChunk* Chunk)
+{
+    if (!Chunk || !Chunk->IsGenerated() || !Chunk->HasVoxelData()) return;
+
+    const FChunkCoord Coord = Chunk->GetChunkCoord();
+
+    for (int32 DZ = -1; DZ <= 1; ++DZ)
+    {
+        for (int32 DY = -1; DY <= 1; ++DY)
+        {
+            for (int32 DX = -1; DX <= 1; ++DX)
+            {
+                if (DX == 0 && DY == 0 && DZ == 0) continue;
+
+                AVoxelChunk* Neighbor = GetChunk(FChunkCoord(Coord.X + DX, Coord.Y + DY, Coord.Z + DZ));
+                if (!Neighbor || !IsValid(Neighbor) || !Neighbor->IsGenerated() || !Neighbor->HasVoxelData())
+                {
+                    continue;
+                }
+
+                // Pull edits the neighbour made to voxels it owns
+                Chunk->CopyApronFrom(*Neighbor);
+
+                // Push ours - the neighbour only needs a new mesh if its apron actually changed
+                if (Neighbor->CopyApronFrom(*Chunk))
+                {
+                    QueueChunkForRebuild(Neighbor);
+                }
+            }
+        }
+    }
+}
+
 float AVoxelWorldManager::GetChunkDistanceFromCenter(const FChunkCoord& ChunkCoord) const
 {
     // Use horizontal distance only (ignore Z for LOD/loading)
@@ -828,11 +1892,54 @@ float AVoxelWorldManager::GetChunkDistanceFromCenter(const FChunkCoord& ChunkCoo
     return FMath::Sqrt(DX * DX + DY * DY);
 }
 
-void AVoxelWorldManager::SortQueueByDistance(TArray<FChunkCoord>& Queue)
+float AVoxelWorldManager::GetChunkPriority(const FChunkCoord& ChunkCoord) const
 {
-    Queue.Sort([this](const FChunkCoord& A, const FChunkCoord& B)
+    const float Distance = GetChunkDistanceFromCenter(ChunkCoord);
+    if (!WorldSettings.bPrioritizeViewDirection || !bHasViewInfo)
     {
-        return GetChunkDistanceFromCenter(A) < GetChunkDistanceFromCenter(B);
+        return Distance;
+    }
+
+    const float ChunkWorldSize = WorldSettings.ChunkSize * WorldSettings.VoxelSize;
+    const FVector ChunkCenter = (FVector(ChunkCoord.X, ChunkCoord.Y, ChunkCoord.Z) + 0.5) * ChunkWorldSize;
+    const FVector ToChunk = (ChunkCenter - ViewOrigin).GetSafeNormal();
+
+    // Anything inside the view cone counts as nearer, anything behind as further
+    const float Facing = FVector::DotProduct(ToChunk, ViewForward);
+    float Weight = Facing >= ViewCosHalfFOV ? 1.0f - ViewDirectionWeight : 1.0f - ViewDirectionWeight * 0.5f * Facing;
+
+    // Moving towards a chunk pulls it forward further, saturating at one chunk per second
+    const float Speed = ViewVelocity.Size();
+    if (Speed > KINDA_SMALL_NUMBER)
+    {
+        const float Heading = FVector::DotProduct(ToChunk, ViewVelocity / Speed);
+        Weight -= VelocityWeight * FMath::Min(Speed / ChunkWorldSize, 1.0f) * FMath::Max(Heading, 0.0f);
+    }
+
+    return Distance * FMath::Max(Weight, 0.1f);
+}
+
+void AVoxelWorldManager::RescoreQueuesIfDirty()
+{
+    if (!bQueuePrioritiesDirty)
+    {
+        return;
+    }
+
+    bQueuePrioritiesDirty = false;
+    ScoredViewOrigin = ViewOrigin;
+    ScoredViewForward = ViewForward;
+    ScoredViewVelocity = ViewVelocity;
+
+    ChunkGenerationQueue.Rescore([this](const FChunkCoord& Coord)
+    {
+        return GetChunkPriority(Coord);
+    });
+
+    // Chunks destroyed while queued score first and are dropped by the pop
+    MeshBuildQueue.Rescore([this](AVoxelChunk* Chunk)
+    {
+        return IsValid(Chunk) ? GetChunkPriority(Chunk->GetChunkCoord()) : 0.0f;
     });
 }
 
@@ -852,31 +1959,57 @@ FVoxel AVoxelWorldManager::GetVoxelAtWorldPosition(const FVector& WorldPosition)
         return Chunk->GetVoxel(LocalX, LocalY, LocalZ);
     }
 
+    // Skipped solid chunks still block raycasts - and report the voxel's real material (bedrock, gravel layers, ...),
+    // which the generator reproduces exactly since a skipped chunk has never been edited
+    const FVoxelHomogeneousChunk* Skipped = SkippedChunks.Find(ChunkCoord);
+    if (Skipped && Skipped->Content == EVoxelChunkContent::Solid)
+    {
+        if (TerrainGenerator)
+        {
+            const int32 ChunkSize = WorldSettings.ChunkSize;
+            return FVoxel(TerrainGenerator->GetVoxelType(ChunkCoord.X * ChunkSize + LocalX, ChunkCoord.Y * ChunkSize + LocalY, ChunkCoord.Z * ChunkSize + LocalZ));
+        }
+        return FVoxel(Skipped->FillMaterial);
+    }
+
     return FVoxel(EVoxelType::Air);
 }
 
+bool AVoxelWorldManager::IsSolidAtWorldPosition(const FVector& WorldPosition) const
+{
+    FChunkCoord ChunkCoord;
+    int32 LocalX, LocalY, LocalZ;
+    WorldToLocalVoxelCoord(WorldPosition, ChunkCoord, LocalX, LocalY, LocalZ);
+
+    const AVoxelChunk* Chunk = GetChunk(ChunkCoord);
+    if (Chunk && Chunk->IsGenerated() && Chunk->HasVoxelData())
+    {
+        return Chunk->GetDensity(LocalX, LocalY, LocalZ) < 0.0f;
+    }
+
+    const FVoxelHomogeneousChunk* Skipped = SkippedChunks.Find(ChunkCoord);
+    return Skipped && Skipped->Content == EVoxelChunkContent::Solid;
+}
+
 void AVoxelWorldManager::SetVoxelAtWorldPosition(const FVector& WorldPosition, const FVoxel& Voxel)
 {
     FChunkCoord ChunkCoord;
     int32 LocalX, LocalY, LocalZ;
     WorldToLocalVoxelCoord(WorldPosition, ChunkCoord, LocalX, LocalY, LocalZ);
 
-    AVoxelChunk* Chunk = GetChunk(ChunkCoord);
+    AVoxelChunk* Chunk = GetOrMaterializeChunk(ChunkCoord);
     if (Chunk && Chunk->IsGenerated() && Chunk->HasVoxelData())
     {
         Chunk->SetVoxel(LocalX, LocalY, LocalZ, Voxel);
 
-        if (!MeshBuildQueue.Contains(Chunk))
-        {
-            MeshBuildQueue.Add(Chunk);
-        }
+        QueueChunkForRebuild(Chunk);
 
         // Update adjacent chunks if on boundary
         auto QueueNeighborIfNeeded = [this](AVoxelChunk* Neighbor)
         {
-            if (Neighbor && !MeshBuildQueue.Contains(Neighbor))
+            if (Neighbor)
             {
-                MeshBuildQueue.Add(Neighbor);
+                QueueChunkForRebuild(Neighbor);
             }
         };
 
@@ -944,14 +2077,52 @@ bool AVoxelWorldManager::VoxelRaycast(const FVector& Start, const FVector& End,
     float T = 0.0f;
     int32 MaxSteps = FMath::CeilToInt(MaxDistance / VoxelSize) * 3;
 
+    const float ChunkWorldSize = WorldSettings.ChunkSize * VoxelSize;
+
     for (int32 StepCount = 0; StepCount < MaxSteps && T < MaxDistance; ++StepCount)
     {
-        FVoxel Voxel = GetVoxelAtWorldPosition(CurrentPos);
+        // Jump straight out of blocks the chunk's density pyramid proves free of solid voxels
+        FChunkCoord ChunkCoord;
+        int32 LocalX, LocalY, LocalZ;
+        WorldToLocalVoxelCoord(CurrentPos, ChunkCoord, LocalX, LocalY, LocalZ);
+
+        const AVoxelChunk* Chunk = GetChunk(ChunkCoord);
+        FIntVector BlockMin;
+        int32 BlockSize = 0;
+        if (Chunk && Chunk->FindAirBlock(LocalX, LocalY, LocalZ, BlockMin, BlockSize) && BlockSize > 1)
+        {
+            const FVector BoxMin = FVector(ChunkCoord.X, ChunkCoord.Y, ChunkCoord.Z) * ChunkWorldSize + FVector(BlockMin) * VoxelSize;
+            const FVector BoxMax = BoxMin + FVector(BlockSize * VoxelSize);
+
+            // Measured from the true ray point - the DDA's lookup position steps whole voxels per axis and sits off the ray
+            const FVector RayPos = Start + Direction * T;
+
+            // Distance along the ray to the block's exit face
+            float Exit = MAX_FLT;
+            for (int32 Axis = 0; Axis < 3; ++Axis)
+            {
+                if (FMath::Abs(Direction[Axis]) > SMALL_NUMBER)
+                {
+                    const double Boundary = Direction[Axis] > 0 ? BoxMax[Axis] : BoxMin[Axis];
+                    Exit = FMath::Min(Exit, static_cast<float>((Boundary - RayPos[Axis]) / Direction[Axis]));
+                }
+            }
+
+            // Nudge past the face so the next lookup lands in the following voxel, then restart the DDA there
+            Exit = FMath::Max(Exit, 0.0f) + VoxelSize * 0.01f;
+            T += Exit;
+            CurrentPos = Start + Direction * T;
+
+            TMax.X = T + GetTMax(CurrentPos.X, Direction.X, Step.X);
+            TMax.Y = T + GetTMax(CurrentPos.Y, Direction.Y, Step.Y);
+            TMax.Z = T + GetTMax(CurrentPos.Z, Direction.Z, Step.Z);
+            continue;
+        }
 
-        if (Voxel.IsSolid())
+        if (IsSolidAtWorldPosition(CurrentPos))
         {
             OutHitPosition = CurrentPos;
-            OutHitVoxel = Voxel;
+            OutHitVoxel = GetVoxelAtWorldPosition(CurrentPos);
 
             if (TMax.X < TMax.Y && TMax.X < TMax.Z)
                 OutHitNormal = FVector(Step.X > 0 ? -1 : 1, 0, 0);
@@ -1005,7 +2176,7 @@ bool AVoxelWorldManager::VoxelRaycast(const FVector& Start, const FVector& End,
 void AVoxelWorldManager::GetChunkStats(int32& OutLoadedChunks, int32& OutPendingChunks, int32& OutTotalVoxels) const
 {
     OutLoadedChunks = LoadedChunks.Num();
-    OutPendingChunks = ChunkGenerationQueue.Num() + MeshBuildQueue.Num();
+    OutPendingChunks = ChunkGenerationQueue.Num() + MeshBuildQueue.Num() + NumMeshTasksInFlight + CompletedMeshJobs.Num();
 
     int32 VoxelsPerChunk = WorldSettings.ChunkSize * WorldSettings.ChunkSize * WorldSettings.ChunkSize;
     OutTotalVoxels = OutLoadedChunks * VoxelsPerChunk;
@@ -1035,6 +2206,29 @@ float AVoxelWorldManager::GetMemoryUsageMB() const
     return static_cast<float>(TotalBytes) / (1024.0f * 1024.0f);
 }
 
+float AVoxelWorldManager::GetDensityMemorySavedMB() const
+{
+    int64 SavedBytes = 0;
+
+    for (const auto& Pair : LoadedChunks)
+    {
+        if (Pair.Value && IsValid(Pair.Value))
+        {
+            SavedBytes += Pair.Value->GetDensityMemorySaved();
+        }
+    }
+
+    for (const auto& Chunk : ChunkPool)
+    {
+        if (Chunk && IsValid(Chunk))
+        {
+            SavedBytes += Chunk->GetDensityMemorySaved();
+        }
+    }
+
+    return static_cast<float>(SavedBytes) / (1024.0f * 1024.0f);
+}
+
 void AVoxelWorldManager::ForceCleanup()
 {
     UE_LOG(LogVoxelWorld, Log, TEXT("ForceCleanup called - compacting memory..."));
@@ -1064,13 +2258,14 @@ void AVoxelWorldManager::ForceCleanup()
         GEngine->ForceGarbageCollection(true);
     }
 
-    UE_LOG(LogVoxelWorld, Log, TEXT("ForceCleanup complete - Memory usage: %.2f MB"), GetMemoryUsageMB());
+    UE_LOG(LogVoxelWorld, Log, TEXT("ForceCleanup complete - Memory usage: %.2f MB (%.2f MB saved by density quantization)"),
+        GetMemoryUsageMB(), GetDensityMemorySavedMB());
 }
 
 void AVoxelWorldManager::QueueChunkForRebuild(AVoxelChunk* Chunk)
 {
     if (Chunk && IsValid(Chunk) && !MeshBuildQueue.Contains(Chunk))
     {
-        MeshBuildQueue.Add(Chunk);
+        MeshBuildQueue.Push(Chunk, GetChunkPriority(Chunk->GetChunkCoord()));
     }
 }
@@ -7,13 +7,14 @@
 #include "ProceduralMeshComponent.h"
 #include "VoxelTypes.h"
 #include "VoxelMarchingCubes.h"
+#include "VoxelChunkStore.h"
 #include "VoxelChunk.generated.h"
 
 class UVoxelTerrainGenerator;
 
 /**
- * Represents a single chunk in the voxel world
- * Optimized with LOD support, distance-based collision, and memory management
+ * Render proxy for a chunk with geometry
+ * Voxel data lives in the world's FVoxelChunkStore; the actor holds a handle to its entry plus mesh, LOD and collision state
  */
 UCLASS()
 class VOXELWORLD_API AVoxelChunk : public AActor
@@ -28,14 +29,26 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Voxel")
     void InitializeChunk(const FChunkCoord& InChunkCoord, const FVoxelWorldSettings& InSettings, UVoxelTerrainGenerator* InGenerator);
 
-    /** Reset chunk for pooling - clears data but keeps allocations */
+    /** Reset chunk for pooling - detaches it from its data */
     UFUNCTION(BlueprintCallable, Category = "Voxel")
     void ResetChunk();
 
-    /** Generate voxel data for this chunk */
+    /** Point the chunk at its voxel data entry (the store must outlive the attachment) */
+    void AttachData(FVoxelChunkStore* InStore, const FVoxelChunkHandle& InHandle);
+
+    /** Voxel data of this chunk (null when detached) */
+    const FVoxelChunkData* GetData() const;
+
+    /** Handle of this chunk's voxel data entry */
+    const FVoxelChunkHandle& GetDataHandle() const { return DataHandle; }
+
+    /** Generate voxel data for this chunk synchronously (game thread) */
     UFUNCTION(BlueprintCallable, Category = "Voxel")
     void GenerateVoxelData();
 
+    /** Adopt freshly generated data that was published to this chunk's store entry */
+    void NotifyDataGenerated();
+
     /** Build the mesh from voxel data with LOD support */
     UFUNCTION(BlueprintCallable, Category = "Voxel")
     void BuildMesh();
@@ -44,6 +57,22 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Voxel")
     void BuildMeshWithLOD(EVoxelLOD LODLevel);
 
+    // ==========================================
+    // Async Meshing
+    // ==========================================
+
+    /** Snapshot the padded density and materials for a worker-thread mesh build at the current LOD */
+    TSharedRef<FVoxelMeshingJob, ESPMode::ThreadSafe> CreateMeshingJob(uint32 TaskId);
+
+    /** Upload a finished job's mesh - returns false (and drops it) if the job was superseded or its data is stale */
+    bool ApplyMeshingJob(FVoxelMeshingJob& Job);
+
+    /** Check if a meshing task for this chunk has not reported back yet */
+    bool IsMeshTaskInFlight() const { return MeshTaskId != 0; }
+
+    /** Incremented on every voxel data change */
+    uint32 GetDataRevision() const { return DataRevision.Load(); }
+
     /** Get voxel at local position */
     UFUNCTION(BlueprintCallable, Category = "Voxel")
     FVoxel GetVoxel(int32 LocalX, int32 LocalY, int32 LocalZ) const;
@@ -52,7 +81,7 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Voxel")
     void SetVoxel(int32 LocalX, int32 LocalY, int32 LocalZ, const FVoxel& Voxel);
 
-    /** Get density at local position */
+    /** Get density at local position (valid from -1 to ChunkSize+1, including the apron) */
     UFUNCTION(BlueprintCallable, Category = "Voxel")
     float GetDensity(int32 LocalX, int32 LocalY, int32 LocalZ) const;
 
@@ -72,6 +101,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Voxel")
     void SetMaterial(int32 LocalX, int32 LocalY, int32 LocalZ, EVoxelType Material);
 
+    /** Most common non-air material in the chunk (Air if the chunk is empty) */
+    UFUNCTION(BlueprintCallable, Category = "Voxel")
+    EVoxelType GetDominantMaterial() const;
+
     /** Get chunk coordinate */
     UFUNCTION(BlueprintCallable, Category = "Voxel")
     FChunkCoord GetChunkCoord() const { return ChunkCoord; }
@@ -91,11 +124,11 @@ public:
     /** Set neighbor chunks */
     void SetNeighbors(AVoxelChunk* XPos, AVoxelChunk* XNeg, AVoxelChunk* YPos, AVoxelChunk* YNeg, AVoxelChunk* ZPos, AVoxelChunk* ZNeg);
 
-    /** Get density from this chunk or neighbors */
-    float GetDensityIncludingNeighbors(int32 LocalX, int32 LocalY, int32 LocalZ) const;
-
-    /** Get material from this chunk or neighbors */
-    EVoxelType GetMaterialIncludingNeighbors(int32 LocalX, int32 LocalY, int32 LocalZ) const;
+    /**
+     * Refresh the part of this chunk's padded density that the source chunk owns (its [0, ChunkSize)^3 voxels)
+     * Works for any of the 26 neighbours - returns true (and marks the mesh dirty) if any value changed
+     */
+    bool CopyApronFrom(const AVoxelChunk& Source);
 
     // ==========================================
     // LOD and Performance
@@ -109,6 +142,18 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Voxel|Performance")
     void SetLOD(EVoxelLOD NewLOD);
 
+    /**
+     * Faces (bit per EVoxelChunkFace) touching a chunk at another LOD, and how many LODs coarser the coarsest of those is
+     * Flagged faces get a seam skirt - will trigger mesh rebuild if changed
+     */
+    void SetTransitionMask(uint8 NewMask, uint8 NewLevels);
+
+    /** Get the LOD transition mask the next mesh is built with */
+    uint8 GetTransitionMask() const { return TransitionMask; }
+
+    /** Get the LOD gap to the coarsest neighbour the next mesh's skirts are sized for */
+    uint8 GetTransitionLevels() const { return TransitionLevels; }
+
     /** Enable or disable collision for this chunk */
     UFUNCTION(BlueprintCallable, Category = "Voxel|Performance")
     void SetCollisionEnabled(bool bEnabled);
@@ -117,7 +162,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Voxel|Performance")
     bool IsCollisionEnabled() const { return bCollisionEnabled; }
 
-    /** Unload voxel data to free memory (mesh remains) */
+    /** Re-cook collision from the uploaded mesh to match the collision setting - no re-mesh (async if bAsyncCollisionCooking) */
+    void UpdateMeshCollision();
+
+    /** Move voxel data to the cold tier (mesh remains) - the arrays are dropped, only the compressed edit layer stays */
     UFUNCTION(BlueprintCallable, Category = "Voxel|Performance")
     void UnloadVoxelData();
 
@@ -125,7 +173,7 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Voxel|Performance")
     bool HasVoxelData() const { return bHasVoxelData; }
 
-    /** Reload voxel data (regenerates from terrain generator) */
+    /** Reload voxel data synchronously - regenerates from the terrain generator and reapplies the edit layer */
     UFUNCTION(BlueprintCallable, Category = "Voxel|Performance")
     void ReloadVoxelData();
 
@@ -133,6 +181,9 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Voxel|Performance")
     int64 GetMemoryUsage() const;
 
+    /** Bytes the density storage format saves over float densities */
+    int64 GetDensityMemorySaved() const;
+
     /** Get chunk state */
     UFUNCTION(BlueprintCallable, Category = "Voxel|Performance")
     EChunkState GetChunkState() const { return ChunkState; }
@@ -148,6 +199,39 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Voxel|Performance")
     void CompactMemory();
 
+    /** Voxels between stored lattice points (1 = full resolution) */
+    UFUNCTION(BlueprintCallable, Category = "Voxel|Performance")
+    int32 GetDataStep() const;
+
+    /** Lattice step the next generation uses - the current LOD's step when reduced-resolution generation is enabled */
+    int32 GetTargetDataStep() const;
+
+    /**
+     * Drop generated data that is too coarse for the current LOD so the generation queue regenerates it
+     * The old mesh stays up until the finer data is meshed - returns true if the chunk needs regenerating
+     */
+    bool InvalidateCoarseData();
+
+    /** Regenerate reduced-resolution data at full resolution before an edit - returns false if the data cannot be edited */
+    bool EnsureFullResolution();
+
+    /** Bring cold data back synchronously before an edit - returns false if the chunk has no data to edit */
+    bool EnsureDataResident();
+
+    /**
+     * Find the largest density pyramid block around a local voxel that provably holds no solid voxel
+     * @param OutBlockMin Local voxel coordinates of the block's minimum corner
+     * @param OutBlockSize Block edge length in voxels
+     * @return False if the voxel's smallest block may contain solid voxels (or there is no pyramid)
+     */
+    bool FindAirBlock(int32 LocalX, int32 LocalY, int32 LocalZ, FIntVector& OutBlockMin, int32& OutBlockSize) const;
+
+    /**
+     * Check if freshly generated, unedited full-resolution data has no surface, so the chunk can be held as a fill value
+     * @param OutFill Empty or Solid, with the solid chunk's dominant material
+     */
+    bool GetHomogeneousFill(FVoxelHomogeneousChunk& OutFill) const;
+
 protected:
     virtual void BeginPlay() override;
     virtual void BeginDestroy() override;
@@ -167,26 +251,25 @@ protected:
     UPROPERTY()
     TObjectPtr<UVoxelTerrainGenerator> TerrainGenerator;
 
-    /** Density data for smooth terrain (SDF) */
-    TArray<float> DensityData;
+    /** Store owning the voxel data (the world manager's) */
+    FVoxelChunkStore* ChunkStore = nullptr;
 
-    /** Material data */
-    TArray<EVoxelType> MaterialData;
+    /** This chunk's entry in ChunkStore */
+    FVoxelChunkHandle DataHandle;
 
     /** Marching cubes mesher instance */
     TUniquePtr<FVoxelMarchingCubes> MarchingCubes;
 
-    /** Neighbor chunk references */
-    TWeakObjectPtr<AVoxelChunk> NeighborXPos;
-    TWeakObjectPtr<AVoxelChunk> NeighborXNeg;
-    TWeakObjectPtr<AVoxelChunk> NeighborYPos;
-    TWeakObjectPtr<AVoxelChunk> NeighborYNeg;
-    TWeakObjectPtr<AVoxelChunk> NeighborZPos;
-    TWeakObjectPtr<AVoxelChunk> NeighborZNeg;
+    /** Neighbour data entries, indexed by EVoxelChunkFace - plain handles, no UObject lookups */
+    FVoxelChunkHandle NeighborHandles[6];
 
     /** Current LOD level */
     EVoxelLOD CurrentLOD = EVoxelLOD::LOD0;
 
+    /** Faces skirted against a neighbour at another LOD, and the LOD gap the skirts cover (maintained by the world manager's LOD update) */
+    uint8 TransitionMask = 0;
+    uint8 TransitionLevels = 0;
+
     /** Current chunk state */
     EChunkState ChunkState = EChunkState::Unloaded;
 
@@ -199,19 +282,22 @@ protected:
     /** Thread safety flag for async operations */
     TAtomic<bool> bPendingKill{false};
 
-    /** Convert local coordinates to density array index */
-    FORCEINLINE int32 GetDensityIndex(int32 X, int32 Y, int32 Z) const
-    {
-        int32 Size = WorldSettings.ChunkSize + 1;
-        return X + Y * Size + Z * Size * Size;
-    }
+    /** Voxel data revision - bumped on every change so in-flight mesh results can detect staleness */
+    TAtomic<uint32> DataRevision{0};
+
+    /** Latest meshing task started for this chunk (0 = none in flight) */
+    uint32 MeshTaskId = 0;
 
-    /** Convert local coordinates to material array index */
-    FORCEINLINE int32 GetMaterialIndex(int32 X, int32 Y, int32 Z) const
+    /** Flag the data as changed: the mesh is dirty and any in-flight mesh result is stale */
+    FORCEINLINE void MarkDataChanged()
     {
-        return X + Y * WorldSettings.ChunkSize + Z * WorldSettings.ChunkSize * WorldSettings.ChunkSize;
+        bNeedsMeshRebuild = true;
+        ++DataRevision;
     }
 
+    /** Writable voxel data - copied first if an in-flight mesh build still shares it (null when detached) */
+    FVoxelChunkData* GetMutableData();
+
     /** Check if local coordinates are within chunk bounds */
     FORCEINLINE bool IsInBounds(int32 X, int32 Y, int32 Z) const
     {
@@ -228,10 +314,26 @@ protected:
                Z >= 0 && Z <= WorldSettings.ChunkSize;
     }
 
+    /** Check if coordinates are inside the padded density grid (density grid plus apron) */
+    FORCEINLINE bool IsInPaddedDensityBounds(int32 X, int32 Y, int32 Z) const
+    {
+        const int32 Min = -FVoxelMarchingCubes::DensityApron;
+        const int32 Max = WorldSettings.ChunkSize + FVoxelMarchingCubes::DensityApron;
+        return X >= Min && X <= Max &&
+               Y >= Min && Y <= Max &&
+               Z >= Min && Z <= Max;
+    }
+
+    /** Generate density and materials on a lattice Step voxels apart and publish them to the store (game thread) */
+    bool GenerateVoxelDataAtStep(int32 Step);
+
     /** Get color for voxel type */
     FColor GetVoxelColor(EVoxelType Type) const;
 
 private:
     /** Clear mesh data */
     void ClearMesh();
+
+    /** Replace the mesh section with built mesh data (game thread) */
+    void ApplyMeshData(FVoxelMeshData& MeshData, EVoxelLOD LODLevel);
 };
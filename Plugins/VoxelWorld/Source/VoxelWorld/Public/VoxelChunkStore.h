@@ -0,0 +1,289 @@
+// Copyright Your Company. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VoxelTypes.h"
+#include "VoxelDensityStorage.h"
+#include "VoxelMaterialStorage.h"
+#include "VoxelDensityPyramid.h"
+#include "VoxelEditLayer.h"
+#include "VoxelMarchingCubes.h"
+#include "VoxelTerrainGenerator.h"
+#include "UObject/StrongObjectPtr.h"
+
+class FVoxelRegionStore;
+
+/**
+ * Voxel data of a single chunk - plain C++, owned by FVoxelChunkStore and independent of any actor
+ * Local coordinates are full-resolution voxels; the stored lattice holds every DataStep-th one
+ */
+struct VOXELWORLD_API FVoxelChunkData
+{
+    FChunkCoord ChunkCoord;
+    int32 ChunkSize = 32;
+
+    /** Voxels between stored density/material lattice points (1 = full resolution, up to the LOD step for far chunks) */
+    int32 DataStep = 1;
+
+    /** Density (SDF) - (ChunkSize/DataStep+1)^3 grid padded by FVoxelMarchingCubes::DensityApron on every side */
+    FVoxelDensityStorage DensityData;
+
+    /** Materials - (ChunkSize/DataStep)^3 cells, palette-packed */
+    FVoxelMaterialStorage MaterialData;
+
+    /** Min/max and averaged mip chain of DensityData - rebuilt on generation, updated incrementally on edits */
+    FVoxelDensityPyramid DensityPyramid;
+
+    /** Every edit since generation as sparse overrides (apron syncs do not count) - regenerating and applying it restores the data */
+    FVoxelEditLayer Edits;
+
+    /** Cold tier: the edit layer serialized and LZ4-compressed, with the arrays dropped - empty while the data is resident */
+    TArray<uint8> CompressedPayload;
+    int32 UncompressedPayloadSize = 0;
+
+    /** Set by edits since the layer was generated or loaded from disk - only these entries are saved on release */
+    bool bUnsavedEdits = false;
+
+    /**
+     * Generate density and materials for a chunk on a lattice Step voxels apart, then apply the edit layer - safe on any thread
+     * Edited chunks are always generated at full resolution
+     * @return False if cancelled
+     */
+    bool Generate(const UVoxelTerrainGenerator& Generator, const FChunkCoord& InChunkCoord, int32 InChunkSize, int32 Step,
+        EVoxelDensityFormat DensityFormat, const TAtomic<bool>* bCancelled = nullptr);
+
+    /** Lattice step a chunk at this LOD is generated with */
+    static int32 GetTargetDataStep(const FVoxelWorldSettings& Settings, EVoxelLOD LOD);
+
+    /** Check if the arrays hold generated data */
+    bool HasData() const { return DensityData.Num() > 0; }
+
+    /** Check if the edit layer sits compressed in the cold tier */
+    bool IsCompressed() const { return CompressedPayload.Num() > 0; }
+
+    /** Check if the data differs from what the generator produces (resident or cold edits) */
+    bool HasEdits() const { return !Edits.IsEmpty() || IsCompressed(); }
+
+    /**
+     * Move to the cold tier: drop the arrays and pyramid, keep only the edit layer, LZ4-compressed - safe on any thread
+     * @return False (data left as it was) if compression failed
+     */
+    bool Compress();
+
+    /** Carry another version's edits (resident or cold) into this data ahead of Generate - safe on any thread */
+    bool TakeEditsFrom(const FVoxelChunkData& Previous);
+
+    /** The edit layer serialized and LZ4-compressed - the cold payload as it is, or compressed now (empty if unedited) */
+    bool GetCompressedEdits(TArray<uint8>& OutPayload, int32& OutUncompressedSize) const;
+
+    /** Rebuild an edit layer from a compressed payload, wherever it lives (e.g. a mapped region file) */
+    static bool DecompressEdits(const uint8* Payload, int32 PayloadSize, int32 UncompressedSize, FVoxelEditLayer& OutEdits);
+
+    /** Density at local coordinates (padded range), trilinear between lattice points for reduced data - air outside */
+    float GetDensity(int32 LocalX, int32 LocalY, int32 LocalZ) const;
+
+    /** Material of the lattice cell holding a local voxel - air outside */
+    EVoxelType GetMaterial(int32 LocalX, int32 LocalY, int32 LocalZ) const;
+
+    /**
+     * Find the largest density pyramid block around a local voxel that provably holds no solid voxel
+     * @param OutBlockMin Local voxel coordinates of the block's minimum corner
+     * @param OutBlockSize Block edge length in voxels
+     */
+    bool FindAirBlock(int32 LocalX, int32 LocalY, int32 LocalZ, FIntVector& OutBlockMin, int32& OutBlockSize) const;
+
+    /** Check if unedited full-resolution data has no surface, so the chunk can be held as a fill value */
+    bool GetHomogeneousFill(FVoxelHomogeneousChunk& OutFill) const;
+
+    /**
+     * Refresh the part of this padded density that the source chunk owns (its [0, ChunkSize)^3 voxels)
+     * Works for any of the 26 neighbours - returns true if any value changed
+     */
+    bool CopyApronFrom(const FVoxelChunkData& Source);
+
+    /** Free the arrays */
+    void Empty();
+
+    /** Release slack */
+    void Shrink();
+
+    /** Memory held by the arrays and the pyramid */
+    SIZE_T GetAllocatedSize() const;
+
+    /** Cells per axis of the stored lattice */
+    FORCEINLINE int32 GetDataCellsPerAxis() const { return ChunkSize / DataStep; }
+
+    /** Convert lattice coordinates to padded density array index (lattice == local coordinates at full resolution) */
+    FORCEINLINE int32 GetDensityIndex(int32 X, int32 Y, int32 Z) const
+    {
+        const int32 Apron = FVoxelMarchingCubes::DensityApron;
+        const int32 Size = FVoxelMarchingCubes::GetPaddedDensitySize(GetDataCellsPerAxis());
+        return (X + Apron) + (Y + Apron) * Size + (Z + Apron) * Size * Size;
+    }
+
+    /** Convert lattice coordinates to material array index (lattice == local coordinates at full resolution) */
+    FORCEINLINE int32 GetMaterialIndex(int32 X, int32 Y, int32 Z) const
+    {
+        const int32 Cells = GetDataCellsPerAxis();
+        return X + Y * Cells + Z * Cells * Cells;
+    }
+
+private:
+    /** Trilinearly sample reduced-resolution density at full-resolution local coordinates (padded range) */
+    float SampleReducedDensity(int32 LocalX, int32 LocalY, int32 LocalZ) const;
+};
+
+/** Read-only view of a chunk's data that stays valid (and unchanged) while the store moves on */
+using FVoxelChunkDataSnapshot = TSharedPtr<const FVoxelChunkData, ESPMode::ThreadSafe>;
+
+/** Stable reference to a store entry - valid until the entry is removed, never aliases a later entry in the same slot */
+struct FVoxelChunkHandle
+{
+    int32 Index = INDEX_NONE;
+    uint32 Serial = 0;
+
+    FORCEINLINE bool IsSet() const { return Index != INDEX_NONE; }
+
+    FORCEINLINE bool operator==(const FVoxelChunkHandle& Other) const
+    {
+        return Index == Other.Index && Serial == Other.Serial;
+    }
+
+    FORCEINLINE bool operator!=(const FVoxelChunkHandle& Other) const
+    {
+        return !(*this == Other);
+    }
+};
+
+/**
+ * Central owner of chunk voxel data, keyed by chunk coordinate
+ * Lookups probe a flat open-addressing table of packed coordinates; entries live in a slot array addressed by handles,
+ * so neighbour access is an index and a serial compare. Snapshots share an entry's data until the next write copies it
+ * Game thread only - workers see nothing but snapshots and the data their own generation job produced
+ */
+class VOXELWORLD_API FVoxelChunkStore
+{
+public:
+    /** Find the entry for a coordinate, adding an empty one if there is none */
+    FVoxelChunkHandle FindOrAdd(const FChunkCoord& Coord);
+
+    /** Find the entry for a coordinate (unset handle if there is none) */
+    FVoxelChunkHandle Find(const FChunkCoord& Coord) const;
+
+    FORCEINLINE bool Contains(const FChunkCoord& Coord) const { return Find(Coord).IsSet(); }
+
+    /** Remove a coordinate's entry - outstanding snapshots keep their data alive */
+    bool Remove(const FChunkCoord& Coord);
+
+    /** Remove every entry */
+    void Empty();
+
+    /** Check if a handle still refers to a live entry */
+    FORCEINLINE bool IsValid(const FVoxelChunkHandle& Handle) const
+    {
+        return Slots.IsValidIndex(Handle.Index) && Slots[Handle.Index].Serial == Handle.Serial && Slots[Handle.Index].Data.IsValid();
+    }
+
+    /** Data of an entry (null for stale handles) */
+    FORCEINLINE const FVoxelChunkData* Get(const FVoxelChunkHandle& Handle) const
+    {
+        return IsValid(Handle) ? Slots[Handle.Index].Data.Get() : nullptr;
+    }
+
+    /** Writable data of an entry - copied first if a snapshot still shares it (null for stale handles) */
+    FVoxelChunkData* GetMutable(const FVoxelChunkHandle& Handle);
+
+    /** Share an entry's current data - later writes to the entry never show through */
+    FVoxelChunkDataSnapshot Snapshot(const FVoxelChunkHandle& Handle) const;
+
+    /** Replace an entry's data wholesale (a finished generation job's result) */
+    void SetData(const FVoxelChunkHandle& Handle, const TSharedRef<FVoxelChunkData, ESPMode::ThreadSafe>& NewData);
+
+    /** Number of entries */
+    int32 Num() const { return NumEntries; }
+
+    /** Memory held by the table, the slots and every entry's data */
+    SIZE_T GetAllocatedSize() const;
+
+    /** Pack a chunk coordinate into a 64-bit key (21 bits per axis) */
+    static FORCEINLINE uint64 PackCoord(const FChunkCoord& Coord)
+    {
+        constexpr uint64 Mask = (1ull << 21) - 1;
+        return (static_cast<uint64>(Coord.X) & Mask) | ((static_cast<uint64>(Coord.Y) & Mask) << 21) | ((static_cast<uint64>(Coord.Z) & Mask) << 42);
+    }
+
+private:
+    struct FSlot
+    {
+        TSharedPtr<FVoxelChunkData, ESPMode::ThreadSafe> Data;
+
+        /** Bumped on removal so handles to the old entry go stale */
+        uint32 Serial = 0;
+    };
+
+    struct FBucket
+    {
+        uint64 Key = 0;
+        int32 Slot = EmptyBucket;
+    };
+
+    static constexpr int32 EmptyBucket = -1;
+    static constexpr int32 TombstoneBucket = -2;
+
+    /** Entries, addressed by handle index */
+    TArray<FSlot> Slots;
+    TArray<int32> FreeSlots;
+
+    /** Power-of-two, linearly probed; keys live in the buckets so a probe never touches the slots */
+    TArray<FBucket> Buckets;
+    int32 NumEntries = 0;
+    int32 NumTombstones = 0;
+
+    /** Bucket holding a key, or INDEX_NONE */
+    int32 FindBucket(uint64 Key) const;
+
+    /** Rebuild the table with a new bucket count, dropping tombstones */
+    void Rehash(int32 NewNumBuckets);
+
+    static FORCEINLINE uint32 HashKey(uint64 Key)
+    {
+        // 64-bit finalizer - packed coordinates differ mostly in low bits of each field
+        Key ^= Key >> 33;
+        Key *= 0xff51afd7ed558ccdull;
+        Key ^= Key >> 33;
+        Key *= 0xc4ceb9fe1a85ec53ull;
+        Key ^= Key >> 33;
+        return static_cast<uint32>(Key);
+    }
+};
+
+/** Generation work for one chunk - runs on any thread without touching an actor or the store */
+struct VOXELWORLD_API FVoxelGenerationJob
+{
+    /** Inputs */
+    FChunkCoord ChunkCoord;
+    FVoxelChunkHandle Handle;
+    int32 ChunkSize = 32;
+    int32 DataStep = 1;
+    EVoxelDensityFormat DensityFormat = EVoxelDensityFormat::Float32;
+
+    /** Strong reference - the job may outlive the manager that created it, and a rebuild swaps the manager's generator */
+    TStrongObjectPtr<UVoxelTerrainGenerator> Generator;
+
+    /** Set by the game thread when the entry is unloaded before the job ran */
+    TAtomic<bool> bCancelled{false};
+
+    /** Edited entry data being replaced - its edits (resident or cold) are applied over the regenerated baseline */
+    FVoxelChunkDataSnapshot Source;
+
+    /** Persisted edits to load ahead of generation when there is no Source (null if persistence is off) */
+    TSharedPtr<FVoxelRegionStore, ESPMode::ThreadSafe> RegionStore;
+
+    /** Output - null if cancelled */
+    TSharedPtr<FVoxelChunkData, ESPMode::ThreadSafe> Result;
+    double BuildTimeMs = 0.0;
+
+    /** Generate the chunk and reapply Source's (or the region store's) edits - safe on any thread */
+    void Execute();
+};
@@ -0,0 +1,79 @@
+// Copyright Your Company. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VoxelDensityStorage.h"
+
+/**
+ * Min/max and averaged density mip chain over a chunk's density lattice
+ * Level L summarises blocks of 2^L lattice cells, up to a single block for the whole chunk
+ * Min/max levels are conservative bounds of the raw lattice (block corners inclusive) - a block whose bounds
+ * do not straddle the surface level cannot contain a sign change and can be skipped by the mesher and raycasts
+ * Averaged levels are filtered point grids the LOD mesher reads instead of point-sampling the raw lattice
+ */
+class VOXELWORLD_API FVoxelDensityPyramid
+{
+public:
+    /** Build every level from a padded density grid with CellsPerAxis cells per axis */
+    void Build(const FVoxelDensityStorage& PaddedDensity, int32 InCellsPerAxis);
+
+    /** Refresh only the blocks and filtered points that depend on lattice points Min..Max (inclusive, padded range allowed) */
+    void UpdateRegion(const FVoxelDensityStorage& PaddedDensity, const FIntVector& Min, const FIntVector& Max);
+
+    /** Free all levels */
+    void Reset();
+
+    /** Check if the levels describe the current data */
+    bool IsBuilt() const { return NumLevels > 0; }
+
+    /** Number of levels above the raw lattice (level 1 = 2x, the last level is the coarsest) */
+    int32 GetNumLevels() const { return NumLevels; }
+
+    /** Lattice cells per axis the pyramid was built for */
+    int32 GetCellsPerAxis() const { return CellsPerAxis; }
+
+    /** Blocks per axis at a level */
+    FORCEINLINE int32 GetBlocksPerAxis(int32 Level) const { return CellsPerAxis >> Level; }
+
+    /** Density bounds of a block (Level 1..GetNumLevels()) */
+    FORCEINLINE void GetBlockBounds(int32 Level, int32 BlockX, int32 BlockY, int32 BlockZ, float& OutMin, float& OutMax) const
+    {
+        const int32 Blocks = GetBlocksPerAxis(Level);
+        const int32 Index = BlockX + BlockY * Blocks + BlockZ * Blocks * Blocks;
+        OutMin = MinLevels[Level - 1][Index];
+        OutMax = MaxLevels[Level - 1][Index];
+    }
+
+    /**
+     * Filtered point grid of a level, ((CellsPerAxis >> Level) + 1)^3 values without apron
+     * Interior points are a recursive [1 2 1] tent filter of the level below; face points stay point samples so
+     * neighbouring chunks agree on their shared faces
+     */
+    const TArray<float>& GetAveragedLevel(int32 Level) const { return AveragedLevels[Level - 1]; }
+
+    /** Memory held by all levels */
+    SIZE_T GetAllocatedSize() const;
+
+private:
+    int32 CellsPerAxis = 0;
+    int32 PaddedSize = 0;
+    int32 NumLevels = 0;
+
+    /** Per-level data, indexed by Level - 1 */
+    TArray<TArray<float>> MinLevels;
+    TArray<TArray<float>> MaxLevels;
+    TArray<TArray<float>> AveragedLevels;
+
+    /** Raw lattice value (lattice coordinates, apron excluded) */
+    FORCEINLINE float GetRaw(const FVoxelDensityStorage& Density, int32 X, int32 Y, int32 Z) const;
+
+    /** Point value at a level (0 = raw lattice) */
+    FORCEINLINE float GetLevelPoint(const FVoxelDensityStorage& Density, int32 Level, int32 X, int32 Y, int32 Z) const;
+
+    /** Recompute block bounds in BlockMin..BlockMax at a level */
+    void UpdateBounds(const FVoxelDensityStorage& Density, int32 Level, const FIntVector& BlockMin, const FIntVector& BlockMax);
+
+    /** Recompute filtered points in PointMin..PointMax at a level */
+    void UpdateAverages(const FVoxelDensityStorage& Density, int32 Level, const FIntVector& PointMin, const FIntVector& PointMax);
+};
@@ -0,0 +1,79 @@
+// Copyright Your Company. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VoxelTypes.h"
+
+/**
+ * Density array stored as float or as 16/8-bit SNORM
+ * SNORM values are Round(Density * Scale) with Scale = 32767 or 127, so decode -> encode returns the same code exactly
+ */
+class VOXELWORLD_API FVoxelDensityStorage
+{
+public:
+    /** Replace the contents with quantized copies of Source */
+    void Encode(const TArray<float>& Source, EVoxelDensityFormat InFormat);
+
+    /** Expand every value to float (vectorized for the SNORM formats) */
+    void Decode(TArray<float>& Out) const;
+
+    /** Density at an index */
+    FORCEINLINE float Get(int32 Index) const
+    {
+        switch (Format)
+        {
+        case EVoxelDensityFormat::SNorm16:  return static_cast<float>(reinterpret_cast<const int16*>(Bytes.GetData())[Index]) * (1.0f / 32767.0f);
+        case EVoxelDensityFormat::SNorm8:   return static_cast<float>(reinterpret_cast<const int8*>(Bytes.GetData())[Index]) * (1.0f / 127.0f);
+        default:                            return reinterpret_cast<const float*>(Bytes.GetData())[Index];
+        }
+    }
+
+    /** Store a density (clamped to [-1, 1] and rounded to the nearest code) */
+    FORCEINLINE void Set(int32 Index, float Value)
+    {
+        switch (Format)
+        {
+        case EVoxelDensityFormat::SNorm16:  reinterpret_cast<int16*>(Bytes.GetData())[Index] = static_cast<int16>(ToCode(Value, 32767)); break;
+        case EVoxelDensityFormat::SNorm8:   reinterpret_cast<int8*>(Bytes.GetData())[Index] = static_cast<int8>(ToCode(Value, 127)); break;
+        default:                            reinterpret_cast<float*>(Bytes.GetData())[Index] = Value; break;
+        }
+    }
+
+    /**
+     * Add a delta and clamp to [-1, 1]
+     * A non-zero delta always moves a quantized value by at least one code, so many small brush steps accumulate
+     * instead of each rounding back to the value it started from
+     */
+    void Add(int32 Index, float Delta);
+
+    /** Number of densities */
+    FORCEINLINE int32 Num() const { return NumValues; }
+    FORCEINLINE bool IsValidIndex(int32 Index) const { return Index >= 0 && Index < NumValues; }
+
+    EVoxelDensityFormat GetFormat() const { return Format; }
+
+    /** Free the allocation */
+    void Empty();
+
+    /** Release slack */
+    void Shrink() { Bytes.Shrink(); }
+
+    /** Memory held by the values */
+    SIZE_T GetAllocatedSize() const { return Bytes.GetAllocatedSize(); }
+
+    /** Bytes per density in a format */
+    static int32 GetBytesPerValue(EVoxelDensityFormat InFormat);
+
+private:
+    EVoxelDensityFormat Format = EVoxelDensityFormat::Float32;
+    int32 NumValues = 0;
+
+    /** Raw values, reinterpreted per format */
+    TArray<uint8> Bytes;
+
+    FORCEINLINE static int32 ToCode(float Value, int32 Scale)
+    {
+        return FMath::RoundToInt(FMath::Clamp(Value, -1.0f, 1.0f) * Scale);
+    }
+};
@@ -0,0 +1,76 @@
+// Copyright Your Company. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VoxelTypes.h"
+
+class FVoxelDensityStorage;
+class FVoxelMaterialStorage;
+
+/**
+ * Sparse per-chunk overrides on top of the generated baseline
+ * The padded full-resolution lattice is split into BrickSize^3 bricks; only bricks touched by an edit are allocated,
+ * each holding the final density/material of its edited points plus bitmasks of which points are overridden.
+ * Regenerating a chunk and applying its layer reproduces the edited data exactly
+ */
+class VOXELWORLD_API FVoxelEditLayer
+{
+public:
+    static constexpr int32 BrickSize = 8;
+    static constexpr int32 BrickVolume = BrickSize * BrickSize * BrickSize;
+
+    /** Record the final density of a local voxel (padded range) */
+    void SetDensity(int32 ChunkSize, int32 LocalX, int32 LocalY, int32 LocalZ, float Density);
+
+    /** Record the final material of a local voxel */
+    void SetMaterial(int32 ChunkSize, int32 LocalX, int32 LocalY, int32 LocalZ, EVoxelType Material);
+
+    /** Write every override into full-resolution chunk data (false, writing nothing, if the layer was recorded for another chunk size) */
+    bool Apply(int32 ChunkSize, FVoxelDensityStorage& DensityData, FVoxelMaterialStorage& MaterialData) const;
+
+    /** Check if nothing was edited */
+    FORCEINLINE bool IsEmpty() const { return Bricks.Num() == 0; }
+
+    /** Number of allocated bricks */
+    FORCEINLINE int32 NumBricks() const { return Bricks.Num(); }
+
+    /** Free every brick */
+    void Empty();
+
+    /** Save or load the allocated bricks (a malformed load leaves the layer empty and flags the archive) */
+    void Serialize(FArchive& Ar);
+
+    /** Largest Serialize output for a chunk size - every brick allocated with every point overridden */
+    static int64 GetMaxSerializedSize(int32 ChunkSize);
+
+    /** Memory held by the bricks and the lookup */
+    SIZE_T GetAllocatedSize() const { return Bricks.GetAllocatedSize() + BrickLookup.GetAllocatedSize(); }
+
+private:
+    struct FBrick
+    {
+        /** Brick position in the chunk's brick grid */
+        int32 BrickIndex = 0;
+
+        /** One bit per point - set where the point is overridden */
+        uint64 DensityMask[BrickVolume / 64] = {};
+        uint64 MaterialMask[BrickVolume / 64] = {};
+
+        float Density[BrickVolume];
+        EVoxelType Material[BrickVolume];
+    };
+
+    /** Allocated bricks, in edit order */
+    TArray<FBrick> Bricks;
+
+    /** Brick grid index -> Bricks index (INDEX_NONE if untouched), allocated on the first edit */
+    TArray<int16> BrickLookup;
+    int32 BricksPerAxis = 0;
+
+    /** Bricks per axis covering the padded lattice of a chunk size */
+    static int32 GetBricksPerAxis(int32 ChunkSize);
+
+    /** Brick and point holding a local voxel, allocating the brick if needed (null if out of range) */
+    FBrick* FindOrAddBrick(int32 ChunkSize, int32 LocalX, int32 LocalY, int32 LocalZ, int32& OutPoint);
+};
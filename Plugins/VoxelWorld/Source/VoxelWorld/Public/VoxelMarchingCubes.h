@@ -4,36 +4,65 @@
 
 #include "CoreMinimal.h"
 #include "VoxelTypes.h"
+#include "VoxelDensityPyramid.h"
+
+struct FVoxelChunkData;
 
 /**
- * Marching Cubes implementation with LOD support and vertex deduplication
+ * Marching Cubes implementation with LOD support and edge-indexed vertex sharing
  */
 class VOXELWORLD_API FVoxelMarchingCubes
 {
 public:
+    /** Voxels of neighbour data stored around each side of a chunk's (ChunkSize+1)^3 density grid */
+    static constexpr int32 DensityApron = 1;
+
+    /** Edge length of the padded density grid for a chunk size */
+    static constexpr int32 GetPaddedDensitySize(int32 InChunkSize) { return InChunkSize + 1 + 2 * DensityApron; }
+
+    /**
+     * Mesh step on a lattice stored DataStep voxels apart (data coarser than the LOD step meshes at its own resolution)
+     * Halved until it divides CellsPerAxis, like UVoxelTerrainGenerator::GetEffectiveDataStep - the kernel's cells must tile the lattice
+     */
+    static constexpr int32 GetLatticeStepSize(int32 LODStepSize, int32 DataStep, int32 CellsPerAxis)
+    {
+        int32 Step = LODStepSize > DataStep ? LODStepSize / DataStep : 1;
+        while (Step > 1 && CellsPerAxis % Step != 0)
+        {
+            Step /= 2;
+        }
+        return Step;
+    }
+
     FVoxelMarchingCubes(int32 InChunkSize, float InVoxelSize, float InSurfaceLevel = 0.0f);
 
     /**
      * Generate mesh with LOD support and optional vertex deduplication
-     * @param StepSize LOD step size (1=full, 2=half, 4=quarter, 8=eighth detail)
-     * @param bDeduplicateVertices Whether to share vertices between triangles
+     * Pure array kernel - every density read (including gradient normals) comes from the padded grid
+     * @param PaddedDensity Density grid with a DensityApron border, GetPaddedDensitySize(ChunkSize)^3 values
+     * @param MaterialData Cell materials, ChunkSize^3 values
+     * @param StepSize LOD step size (1=full, 2=half, 4=quarter, 8=eighth detail) - must divide the chunk size, see GetLatticeStepSize
+     * @param bDeduplicateVertices Whether cells share the vertex on each lattice edge
+     * @param TransitionMask Bit per EVoxelChunkFace that touches a chunk meshed at another LOD (across the face, an edge or a corner)
+     * @param TransitionLevels How many LODs coarser than StepSize the coarsest of those chunks is (0 if they are all finer)
+     * @param Pyramid Optional mip chain of PaddedDensity - LOD steps read its filtered level, and blocks its bounds
+     *        prove free of sign changes are skipped
      */
     void GenerateMeshLOD(
-        const TArray<float>& DensityData,
+        const TArray<float>& PaddedDensity,
         const TArray<EVoxelType>& MaterialData,
-        TFunction<float(int32, int32, int32)> GetNeighborDensity,
-        TFunction<EVoxelType(int32, int32, int32)> GetNeighborMaterial,
         FVoxelMeshData& OutMeshData,
         int32 StepSize = 1,
-        bool bDeduplicateVertices = true
+        bool bDeduplicateVertices = true,
+        uint8 TransitionMask = 0,
+        int32 TransitionLevels = 0,
+        const FVoxelDensityPyramid* Pyramid = nullptr
     );
 
     /** Legacy method - calls GenerateMeshLOD with step size 1 */
     void GenerateMesh(
-        const TArray<float>& DensityData,
+        const TArray<float>& PaddedDensity,
         const TArray<EVoxelType>& MaterialData,
-        TFunction<float(int32, int32, int32)> GetNeighborDensity,
-        TFunction<EVoxelType(int32, int32, int32)> GetNeighborMaterial,
         FVoxelMeshData& OutMeshData
     );
 
@@ -41,71 +70,115 @@ public:
 
 private:
     int32 ChunkSize;
+    int32 PaddedSize;
     float VoxelSize;
     float SurfaceLevel;
 
-    /** Vertex deduplication map - maps position hash to vertex index */
-    TMap<uint64, int32> VertexMap;
+    /**
+     * Edge-owned vertex cache: every lattice point owns its +X, +Y and +Z edges
+     * Two Z slices of (point, axis) -> vertex index, used as a ring buffer while marching up the chunk (-1 = no vertex yet)
+     */
+    TArray<int32> EdgeVertexCache;
 
-    FORCEINLINE int32 GetIndex(int32 X, int32 Y, int32 Z) const
-    {
-        return X + Y * (ChunkSize + 1) + Z * (ChunkSize + 1) * (ChunkSize + 1);
-    }
+    /** Per pyramid block: set when the block provably contains no sign change */
+    TBitArray<> SurfaceFreeBlocks;
+
+    /**
+     * Flag the pyramid blocks at SkipLevel that cannot produce triangles
+     * With filtered corners a block's neighbours are checked too, since the filter reaches one LOD cell past the block
+     */
+    void BuildSurfaceFreeBlocks(const FVoxelDensityPyramid& Pyramid, int32 SkipLevel, bool bFilteredCorners);
 
-    /** Hash a position for vertex deduplication */
-    FORCEINLINE uint64 HashPosition(const FVector& Position) const
+    /**
+     * Hang a skirt off the surface contour on every face flagged in TransitionMask
+     * Each contour vertex is pushed SkirtDepth into the solid along its normal's in-plane direction, so the skirt stays on the
+     * chunk boundary and is only seen through the cracks and T-junctions a neighbour at another LOD leaves there.
+     * Both sides of a seam carry one, since the gap always lies on the solid side of whichever contour is further out.
+     * This is not Transvoxel: the holes close, but geometry and shading still step at the seam, so it does not by itself
+     * allow shorter LOD distances
+     * @param SkirtDepth World-space reach into the solid - the coarsest neighbouring cell size bounds the gap
+     */
+    void AddTransitionSkirts(FVoxelMeshData& MeshData, uint8 TransitionMask, float SkirtDepth);
+
+    /** Index into the padded density grid - local coordinates range from -DensityApron to ChunkSize+DensityApron */
+    FORCEINLINE int32 GetIndex(int32 X, int32 Y, int32 Z) const
     {
-        // Quantize position to avoid floating point precision issues
-        int32 QX = FMath::RoundToInt(Position.X * 100.0f);
-        int32 QY = FMath::RoundToInt(Position.Y * 100.0f);
-        int32 QZ = FMath::RoundToInt(Position.Z * 100.0f);
-
-        // Combine into 64-bit hash
-        return (static_cast<uint64>(QX & 0x1FFFFF) << 42) |
-               (static_cast<uint64>(QY & 0x1FFFFF) << 21) |
-               (static_cast<uint64>(QZ & 0x1FFFFF));
+        return (X + DensityApron) + (Y + DensityApron) * PaddedSize + (Z + DensityApron) * PaddedSize * PaddedSize;
     }
 
-    /** Add vertex with deduplication */
+    /** Append a vertex and return its index */
     int32 AddVertex(
         FVoxelMeshData& OutMeshData,
         const FVector& Position,
         const FVector& Normal,
         const FVector2D& UV,
         const FColor& Color,
-        const FVector& Tangent,
-        bool bDeduplicate
+        const FVector& Tangent
     );
 
-    FVector InterpolateVertex(
+    /** Find the surface crossing on an edge and blend the corner gradients to match */
+    void InterpolateVertex(
         const FVector& P1, const FVector& P2,
-        float D1, float D2
-    ) const;
-
-    FVector CalculateNormal(
-        const TArray<float>& DensityData,
-        TFunction<float(int32, int32, int32)> GetNeighborDensity,
-        int32 X, int32 Y, int32 Z,
-        int32 StepSize
+        const FVector& G1, const FVector& G2,
+        float D1, float D2,
+        FVector& OutPosition, FVector& OutGradient
     ) const;
 
-    float GetDensity(
-        const TArray<float>& DensityData,
-        TFunction<float(int32, int32, int32)> GetNeighborDensity,
-        int32 X, int32 Y, int32 Z
-    ) const;
+    /** Density gradient at a lattice point by central differences (points from solid towards air) */
+    FORCEINLINE FVector CalculateGradient(const float* Density, int32 X, int32 Y, int32 Z) const
+    {
+        return FVector(
+            Density[GetIndex(X + 1, Y, Z)] - Density[GetIndex(X - 1, Y, Z)],
+            Density[GetIndex(X, Y + 1, Z)] - Density[GetIndex(X, Y - 1, Z)],
+            Density[GetIndex(X, Y, Z + 1)] - Density[GetIndex(X, Y, Z - 1)]
+        );
+    }
 
     FColor GetVoxelColor(EVoxelType Type) const;
 
-    EVoxelType GetDominantMaterial(
-        const TArray<EVoxelType>& MaterialData,
-        TFunction<EVoxelType(int32, int32, int32)> GetNeighborMaterial,
-        int32 X, int32 Y, int32 Z
-    ) const;
-
     // Marching Cubes Lookup Tables
     static const int32 EdgeTable[256];
     static const int32 TriangleTable[256][16];
     static const FIntVector CornerOffsets[8];
     static const int32 EdgeConnections[12][2];
+
+    /** Owner of each cube edge: lattice offset of the owning corner (X, Y, Z) and the edge axis (0=X, 1=Y, 2=Z) */
+    static const int32 EdgeOwners[12][4];
+};
+
+/**
+ * Self-contained meshing work for one chunk: an immutable copy of its padded density and materials plus the result
+ * Built on the game thread, executed on a worker, then handed back to the game thread for upload
+ */
+struct VOXELWORLD_API FVoxelMeshingJob
+{
+    /** Chunk this job was created for */
+    FChunkCoord ChunkCoord;
+
+    /** Identifies the request - a chunk only accepts the result of its latest task */
+    uint32 TaskId = 0;
+
+    /** Chunk data revision the snapshot was taken at - results for older data are discarded */
+    uint32 DataRevision = 0;
+
+    /** Mesher parameters */
+    int32 ChunkSize = 32;
+    float VoxelSize = 100.0f;
+    EVoxelLOD LODLevel = EVoxelLOD::LOD0;
+    bool bDeduplicateVertices = true;
+    uint8 TransitionMask = 0;
+    int32 TransitionLevels = 0;
+
+    /**
+     * Shared, read-only snapshot of the chunk's store entry (released once the mesh is built)
+     * Density stays in its storage format until Execute; the mesher runs on a ChunkSize/DataStep grid of DataStep-sized voxels
+     */
+    TSharedPtr<const FVoxelChunkData, ESPMode::ThreadSafe> Data;
+
+    /** Output */
+    FVoxelMeshData MeshData;
+    double BuildTimeMs = 0.0;
+
+    /** Run marching cubes on the snapshot - safe on any thread */
+    void Execute();
 };
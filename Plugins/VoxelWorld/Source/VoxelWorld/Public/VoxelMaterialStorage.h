@@ -0,0 +1,78 @@
+// Copyright Your Company. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VoxelTypes.h"
+
+/**
+ * Palette-compressed material array
+ * A uniform array stores only its single palette entry; otherwise palette indices are bit-packed into 32-bit words
+ * at 1, 2, 4 or 8 bits per value, chosen from the palette size
+ */
+class VOXELWORLD_API FVoxelMaterialStorage
+{
+public:
+    /** Replace the contents with a palette-packed copy of Source */
+    void Encode(const TArray<EVoxelType>& Source);
+
+    /** Expand every value (a fill for uniform arrays, word-at-a-time unpacking otherwise) */
+    void Decode(TArray<EVoxelType>& Out) const;
+
+    /** Material at an index */
+    FORCEINLINE EVoxelType Get(int32 Index) const
+    {
+        if (BitsPerValue == 0)
+        {
+            return Palette[0];
+        }
+
+        const int32 BitOffset = Index * BitsPerValue;
+        const uint32 Code = (Words[BitOffset >> 5] >> (BitOffset & 31)) & ((1u << BitsPerValue) - 1);
+        return Palette[Code];
+    }
+
+    /** Store a material - widens the packing if the palette outgrows it */
+    void Set(int32 Index, EVoxelType Value);
+
+    /** Most common material, optionally ignoring Air (Air if nothing else is present) */
+    EVoxelType GetDominantMaterial(bool bIgnoreAir = true) const;
+
+    /** Number of materials */
+    FORCEINLINE int32 Num() const { return NumValues; }
+    FORCEINLINE bool IsValidIndex(int32 Index) const { return Index >= 0 && Index < NumValues; }
+
+    /** Free the allocation */
+    void Empty();
+
+    /** Drop palette entries no longer referenced by edits, repack, and release slack */
+    void Shrink();
+
+    /** Memory held by the palette and packed words */
+    SIZE_T GetAllocatedSize() const { return Palette.GetAllocatedSize() + Words.GetAllocatedSize(); }
+
+private:
+    int32 NumValues = 0;
+    int32 BitsPerValue = 0;
+
+    /** Materials referenced by the packed indices (inline for the common small palettes) */
+    TArray<EVoxelType, TInlineAllocator<16>> Palette;
+
+    /** Packed palette indices, empty when uniform */
+    TArray<uint32> Words;
+
+    /** Smallest packing (0, 1, 2, 4 or 8 bits) that can address a palette of this size */
+    static int32 GetBitsForPaletteSize(int32 PaletteSize);
+
+    /** Write a palette index without any palette checks */
+    FORCEINLINE void SetCode(int32 Index, uint32 Code)
+    {
+        const int32 BitOffset = Index * BitsPerValue;
+        const uint32 Mask = ((1u << BitsPerValue) - 1) << (BitOffset & 31);
+        uint32& Word = Words[BitOffset >> 5];
+        Word = (Word & ~Mask) | (Code << (BitOffset & 31));
+    }
+
+    /** Re-pack every value at a new width */
+    void Repack(int32 NewBitsPerValue);
+};
@@ -0,0 +1,201 @@
+// Copyright Your Company. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Indexed binary min-heap - lowest priority value pops first
+ * Every key is in the queue at most once; a side map from key to heap slot gives O(1) membership
+ * and lets a queued key be re-prioritized or removed in O(log n)
+ */
+template<typename KeyType>
+class TVoxelPriorityQueue
+{
+public:
+    /**
+     * Add a key, or move it to a new priority if it is already queued
+     * @return True if the key was not queued before
+     */
+    bool Push(const KeyType& Key, float Priority)
+    {
+        if (const int32* Existing = Positions.Find(Key))
+        {
+            const int32 Index = *Existing;
+            const float OldPriority = Heap[Index].Priority;
+            Heap[Index].Priority = Priority;
+
+            if (Priority < OldPriority)
+            {
+                SiftUp(Index);
+            }
+            else
+            {
+                SiftDown(Index);
+            }
+            return false;
+        }
+
+        const int32 Index = Heap.Add(FNode{Key, Priority});
+        Positions.Add(Key, Index);
+        SiftUp(Index);
+        return true;
+    }
+
+    /** Check if a key is queued */
+    FORCEINLINE bool Contains(const KeyType& Key) const { return Positions.Contains(Key); }
+
+    /** Remove a key wherever it sits in the heap - returns false if it was not queued */
+    bool Remove(const KeyType& Key)
+    {
+        int32 Index;
+        if (!Positions.RemoveAndCopyValue(Key, Index))
+        {
+            return false;
+        }
+
+        RemoveAtIndex(Index);
+        return true;
+    }
+
+    /** Key with the lowest priority */
+    FORCEINLINE const KeyType& Top() const
+    {
+        check(Heap.Num() > 0);
+        return Heap[0].Key;
+    }
+
+    /** Remove and return the key with the lowest priority */
+    KeyType Pop()
+    {
+        check(Heap.Num() > 0);
+        KeyType Key = Heap[0].Key;
+        Positions.Remove(Key);
+        RemoveAtIndex(0);
+        return Key;
+    }
+
+    /**
+     * Recompute every priority and restore the heap in O(n)
+     * @param GetPriority Callable taking a key and returning its new priority
+     */
+    template<typename FuncType>
+    void Rescore(FuncType&& GetPriority)
+    {
+        for (FNode& Node : Heap)
+        {
+            Node.Priority = GetPriority(Node.Key);
+        }
+
+        // Floyd's heap construction - sift down every parent, last first
+        for (int32 Index = Heap.Num() / 2 - 1; Index >= 0; --Index)
+        {
+            SiftDown(Index);
+        }
+    }
+
+    FORCEINLINE int32 Num() const { return Heap.Num(); }
+    FORCEINLINE bool IsEmpty() const { return Heap.Num() == 0; }
+
+    void Empty()
+    {
+        Heap.Empty();
+        Positions.Empty();
+    }
+
+    /** Visit every queued key, in heap order (not priority order) */
+    template<typename FuncType>
+    void ForEach(FuncType&& Func) const
+    {
+        for (const FNode& Node : Heap)
+        {
+            Func(Node.Key);
+        }
+    }
+
+private:
+    struct FNode
+    {
+        KeyType Key;
+        float Priority;
+    };
+
+    TArray<FNode> Heap;
+
+    /** Key -> slot in Heap, kept in step with every move */
+    TMap<KeyType, int32> Positions;
+
+    FORCEINLINE void Place(int32 Index, FNode&& Node)
+    {
+        Positions[Node.Key] = Index;
+        Heap[Index] = MoveTemp(Node);
+    }
+
+    /** Fill the hole at Index with the last node and restore the heap (the key's position entry is already gone) */
+    void RemoveAtIndex(int32 Index)
+    {
+        const int32 Last = Heap.Num() - 1;
+        if (Index != Last)
+        {
+            FNode Moved = MoveTemp(Heap[Last]);
+            Heap.RemoveAt(Last, 1, EAllowShrinking::No);
+            const float MovedPriority = Moved.Priority;
+            const float RemovedPriority = Heap[Index].Priority;
+            Place(Index, MoveTemp(Moved));
+
+            if (MovedPriority < RemovedPriority)
+            {
+                SiftUp(Index);
+            }
+            else
+            {
+                SiftDown(Index);
+            }
+        }
+        else
+        {
+            Heap.RemoveAt(Last, 1, EAllowShrinking::No);
+        }
+    }
+
+    void SiftUp(int32 Index)
+    {
+        FNode Node = MoveTemp(Heap[Index]);
+        while (Index > 0)
+        {
+            const int32 Parent = (Index - 1) / 2;
+            if (!(Node.Priority < Heap[Parent].Priority))
+            {
+                break;
+            }
+            Place(Index, MoveTemp(Heap[Parent]));
+            Index = Parent;
+        }
+        Place(Index, MoveTemp(Node));
+    }
+
+    void SiftDown(int32 Index)
+    {
+        const int32 Count = Heap.Num();
+        FNode Node = MoveTemp(Heap[Index]);
+        while (true)
+        {
+            int32 Child = Index * 2 + 1;
+            if (Child >= Count)
+            {
+                break;
+            }
+            if (Child + 1 < Count && Heap[Child + 1].Priority < Heap[Child].Priority)
+            {
+                ++Child;
+            }
+            if (!(Heap[Child].Priority < Node.Priority))
+            {
+                break;
+            }
+            Place(Index, MoveTemp(Heap[Child]));
+            Index = Child;
+        }
+        Place(Index, MoveTemp(Node));
+    }
+};
@@ -0,0 +1,172 @@
+// Copyright Your Company. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VoxelTypes.h"
+#include "VoxelChunkStore.h"
+#include "Misc/ScopeRWLock.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+
+/**
+ * One region file - RegionSizeXY x RegionSizeXY x RegionSizeZ chunks sharing a header offset table
+ * Layout: header, entry table (one entry per chunk, offset 0 = absent), then compressed payloads in append order.
+ * A rewritten chunk gets a fresh payload at the end and its entry is repointed; the old bytes stay dead until compaction
+ * Not thread-safe - FVoxelRegionStore serializes access
+ */
+class VOXELWORLD_API FVoxelRegionFile
+{
+public:
+    static constexpr int32 RegionSizeXY = 32;
+    static constexpr int32 RegionSizeZ = 16;
+    static constexpr int32 NumEntries = RegionSizeXY * RegionSizeXY * RegionSizeZ;
+
+    FVoxelRegionFile(const FString& InPath, int32 InChunkSize);
+    ~FVoxelRegionFile();
+
+    /**
+     * Read the header and entry table if the file exists - a missing file is an empty region, a foreign one is ignored
+     * Finishes a compaction swap that was interrupted by restoring the backup first
+     */
+    void Load();
+
+    /** Check if a chunk has a stored payload */
+    bool HasChunk(int32 EntryIndex) const { return Entries[EntryIndex].Offset != 0; }
+
+    /** One bit per entry, set where a payload is stored */
+    TBitArray<> GetOccupancy() const;
+
+    /** Decompress a chunk's edit layer straight out of the mapped file */
+    bool Read(int32 EntryIndex, FVoxelEditLayer& OutEdits);
+
+    /** Append a compressed payload and repoint the chunk's entry at it (an empty payload removes the chunk), compacting first if the file is full */
+    bool Write(int32 EntryIndex, const TArray<uint8>& Payload, int32 UncompressedSize);
+
+    /** Check if dead payloads take up enough of the file to be worth a rewrite */
+    bool NeedsCompaction() const;
+
+    /** Rewrite the file with live payloads only, then swap it in */
+    bool Compact();
+
+    /** Entry index of a chunk inside its region */
+    static int32 GetEntryIndex(const FChunkCoord& Coord);
+
+    /** Region holding a chunk */
+    static FIntVector GetRegionCoord(const FChunkCoord& Coord);
+
+private:
+    struct FHeader
+    {
+        uint32 Magic = 0;
+        uint32 Version = 0;
+        int32 ChunkSize = 0;
+        int32 NumEntries = 0;
+    };
+
+    struct FEntry
+    {
+        /** Byte offset of the payload (0 = no payload) */
+        uint32 Offset = 0;
+        uint32 CompressedSize = 0;
+        uint32 UncompressedSize = 0;
+    };
+
+    static constexpr uint32 Magic = 0x47525856; // "VXRG"
+    static constexpr uint32 Version = 1;
+    static constexpr int64 PayloadStart = sizeof(FHeader) + sizeof(FEntry) * NumEntries;
+
+    FString Path;
+    int32 ChunkSize = 32;
+
+    TArray<FEntry> Entries;
+
+    /** Bytes past the table, and how many of them no entry points at */
+    int64 FileSize = 0;
+    int64 DeadBytes = 0;
+
+    /** Whole-file mapping, opened on the first read and dropped before the file changes */
+    TUniquePtr<IMappedFileHandle> MappedHandle;
+    TUniquePtr<IMappedFileRegion> MappedRegion;
+
+    /** Map the file if it is not mapped yet */
+    bool EnsureMapped();
+
+    /** Drop the mapping */
+    void Unmap();
+
+    /** Where the old file waits while a compaction swaps the new one in */
+    FString GetBackupPath() const;
+
+    /** Write the header and an entry table to a file handle */
+    bool WriteHeader(IFileHandle& Handle, const TArray<FEntry>& InEntries) const;
+};
+
+/**
+ * Persistence for edited chunks - only the edit layer is stored, the rest regenerates from the seed
+ * Saves are queued from the game thread and written by Flush (normally on a worker); loads may run on any thread
+ * and see queued saves before they reach disk
+ */
+class VOXELWORLD_API FVoxelRegionStore : public TSharedFromThis<FVoxelRegionStore, ESPMode::ThreadSafe>
+{
+public:
+    /** @param InDirectory Folder the region files live in (created on the first write) */
+    FVoxelRegionStore(const FString& InDirectory, int32 InChunkSize);
+    ~FVoxelRegionStore();
+
+    /** Folder for a save slot - seeded per generator, since edits only make sense over the baseline they were made on */
+    static FString GetSaveDirectory(const FString& SlotName, int32 Seed);
+
+    /**
+     * Check if a chunk may have persisted edits (queued or on disk) - never touches the disk, so it is cheap on the game thread
+     * Conservative: answers true until the chunk's region table has been read, which this starts on a worker
+     */
+    bool MayHaveChunk(const FChunkCoord& Coord);
+
+    /**
+     * Load a chunk's persisted edits - safe on any thread
+     * @return False only on a read error; a chunk with nothing stored leaves OutEdits empty
+     */
+    bool LoadEdits(const FChunkCoord& Coord, FVoxelEditLayer& OutEdits);
+
+    /** Queue a chunk's data (resident or cold) to have its edit layer written by the next flush */
+    void SaveEdits(const FChunkCoord& Coord, const FVoxelChunkDataSnapshot& Data);
+
+    /** Write every queued save, then compact regions with too much dead space - safe on any thread */
+    void Flush();
+
+    /** Number of saves waiting for a flush */
+    int32 NumPendingSaves() const;
+
+private:
+    FString Directory;
+    int32 ChunkSize = 32;
+
+    /** Guards PendingSaves */
+    mutable FCriticalSection PendingLock;
+    TMap<FChunkCoord, FVoxelChunkDataSnapshot> PendingSaves;
+
+    /** Guards Regions and every file */
+    FCriticalSection FileLock;
+    TMap<FIntVector, TUniquePtr<FVoxelRegionFile>> Regions;
+
+    /** Guards Occupancy and OccupancyRequests - only ever held for a lookup or a bit update, never across file I/O */
+    FRWLock OccupancyLock;
+
+    /** Entries with a payload on disk, per region whose table has been read */
+    TMap<FIntVector, TBitArray<>> Occupancy;
+
+    /** Regions whose table is being read for MayHaveChunk */
+    TSet<FIntVector> OccupancyRequests;
+
+    /** Only one flush writes at a time */
+    FCriticalSection FlushLock;
+
+    /** Region holding a chunk, loading its table and publishing its occupancy on first use (FileLock held) */
+    FVoxelRegionFile& GetRegion(const FChunkCoord& Coord);
+    FVoxelRegionFile& GetRegionAt(const FIntVector& RegionCoord);
+
+    /** Mirror one entry's state into Occupancy after a write */
+    void SetOccupied(const FChunkCoord& Coord, bool bOccupied);
+};
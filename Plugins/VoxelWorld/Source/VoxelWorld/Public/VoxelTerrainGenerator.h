@@ -4,11 +4,122 @@
 
 #include "CoreMinimal.h"
 #include "UObject/NoExportTypes.h"
+#include "Misc/Optional.h"
 #include "VoxelTypes.h"
 #include "VoxelTerrainGenerator.generated.h"
 
 class UVoxelNoiseGenerator;
 
+/** The two 3D noise layers combined into the cave field */
+enum class ECaveNoiseLayer : uint8
+{
+    Detail,     // 3 octaves at 3x the terrain frequency
+    Shape       // 2 octaves at half the detail frequency
+};
+
+/** Error of a coarse-sampled chunk compared to full-resolution generation */
+USTRUCT(BlueprintType)
+struct VOXELWORLD_API FVoxelSamplingErrorReport
+{
+    GENERATED_BODY()
+
+    /** Largest absolute density difference */
+    UPROPERTY(BlueprintReadOnly, Category = "Terrain")
+    float MaxDensityError = 0.0f;
+
+    /** Mean absolute density difference */
+    UPROPERTY(BlueprintReadOnly, Category = "Terrain")
+    float MeanDensityError = 0.0f;
+
+    /** Density samples that changed between solid and air (moves the surface) */
+    UPROPERTY(BlueprintReadOnly, Category = "Terrain")
+    int32 SignChanges = 0;
+
+    /** Material samples that differ */
+    UPROPERTY(BlueprintReadOnly, Category = "Terrain")
+    int32 MaterialMismatches = 0;
+
+    /** Number of density samples compared */
+    UPROPERTY(BlueprintReadOnly, Category = "Terrain")
+    int32 NumSamples = 0;
+};
+
+/**
+ * Terrain values that depend only on the (X,Y) column and are identical for every Z
+ * Evaluated once per column and shared by the density and material passes of a chunk
+ */
+struct VOXELWORLD_API FVoxelColumnData
+{
+    /** Final surface height (including plateau/valley/canyon features) */
+    float TerrainHeight = 0.0f;
+
+    /** Feature influences (0-1) */
+    float PlateauInfluence = 0.0f;
+    float ValleyInfluence = 0.0f;
+    float CanyonInfluence = 0.0f;
+
+    /** Cave entrance influence (0 when caves are disabled or on plateaus) */
+    float EntranceInfluence = 0.0f;
+
+    /** Ridged tunnel noise around entrances (only valid when EntranceInfluence >= 0.05) */
+    float EntranceTunnelNoise = 0.0f;
+
+    /** Entrance shaft vertical parameters */
+    float ShaftTop = 0.0f;
+    float ShaftBottom = 0.0f;
+    float ChamberBottom = 0.0f;
+
+    /** Climate values used for material selection */
+    float Temperature = 0.5f;
+    float Moisture = 0.5f;
+
+    /** Biome of this column */
+    EBiomeType Biome = EBiomeType::Plains;
+};
+
+/**
+ * Bounded, thread-safe cache of column data shared by all generation threads
+ * Direct-mapped: each entry is guarded by its own sequence lock, so reads never block or write shared state,
+ * and a writer that loses a race for an entry simply skips caching instead of waiting.
+ * Collisions evict - the cache never grows past its fixed capacity.
+ */
+class VOXELWORLD_API FVoxelColumnCache
+{
+public:
+    /** Allocate 2^CapacityLog2 entries and clear them - not safe while other threads use the cache */
+    void Reset(int32 CapacityLog2 = 16);
+
+    /** Copy a cached column into OutColumn - returns false on a miss or a racing write */
+    bool Find(int32 WorldX, int32 WorldY, FVoxelColumnData& OutColumn) const;
+
+    /** Store a column, unless another thread is currently writing the same entry */
+    void Add(int32 WorldX, int32 WorldY, const FVoxelColumnData& Column);
+
+    /** Number of entries (0 before Reset) */
+    int32 GetCapacity() const { return IndexMask + 1; }
+
+private:
+    struct FEntry
+    {
+        /** Odd while being written, 0 until first written */
+        TAtomic<uint32> Sequence{0};
+        int32 X = 0;
+        int32 Y = 0;
+        FVoxelColumnData Data;
+    };
+
+    FORCEINLINE FEntry& GetEntry(int32 WorldX, int32 WorldY) const
+    {
+        // Spread neighbouring columns across the table
+        uint32 Hash = (uint32)WorldX * 0x9E3779B1u ^ (uint32)WorldY * 0x85EBCA77u;
+        Hash ^= Hash >> 15;
+        return Entries[Hash & (uint32)IndexMask];
+    }
+
+    TUniquePtr<FEntry[]> Entries;
+    int32 IndexMask = -1;
+};
+
 /**
  * Terrain generator for voxel worlds using Signed Distance Fields
  * Produces smooth terrain data for Marching Cubes mesh generation
@@ -103,10 +214,59 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Terrain|Caves")
     float GetEntranceTunnelDensity(int32 WorldX, int32 WorldY, int32 WorldZ) const;
 
-    /** Check if a chunk is likely to be empty (for optimization) */
+    // ==========================================
+    // Column (2D) Stage
+    // ==========================================
+
+    /** Evaluate every 2D term of the terrain for a single (X,Y) column (served from the shared column cache) */
+    void GetColumnData(int32 WorldX, int32 WorldY, FVoxelColumnData& OutColumn) const;
+
+    /**
+     * Evaluate the column stage for a SizeX * SizeY block of columns starting at (WorldBaseX, WorldBaseY)
+     * Columns are Stride world voxels apart; output is indexed as X + Y * SizeX
+     */
+    void GenerateColumnData(int32 WorldBaseX, int32 WorldBaseY, int32 SizeX, int32 SizeY, TArray<FVoxelColumnData>& OutColumns, int32 Stride = 1) const;
+
+    /** Get density at a world position using precomputed column data */
+    float GetDensityFromColumn(const FVoxelColumnData& Column, int32 WorldX, int32 WorldY, int32 WorldZ) const;
+
+    /** Get the voxel type at a world position using precomputed column data */
+    EVoxelType GetVoxelTypeFromColumn(const FVoxelColumnData& Column, int32 WorldX, int32 WorldY, int32 WorldZ) const;
+
+    /**
+     * Fused generation of a chunk's density ((ChunkSize+1+2*Apron)^3) and material (ChunkSize^3) grids in one pass
+     * Each voxel's density, cave density and column data are computed once and reused for its material
+     * Apron pads the density grid with that many lattice points (0 or 1) of neighbouring terrain on every side
+     * DataStep > 1 evaluates only every DataStep-th voxel: grids shrink to ChunkSize/DataStep cells per axis
+     * Returns false if cancelled via bCancelled before completion
+     */
+    bool GenerateChunkData(int32 WorldBaseX, int32 WorldBaseY, int32 WorldBaseZ, int32 ChunkSize,
+        TArray<float>& OutDensity, TArray<EVoxelType>& OutMaterials, const TAtomic<bool>* bCancelled = nullptr, int32 Apron = 0,
+        int32 DataStep = 1) const;
+
+    /** Clamp a requested generation data step to a power of two dividing the chunk size (1 = full resolution) */
+    static int32 GetEffectiveDataStep(int32 RequestedStep, int32 ChunkSize);
+
+    /**
+     * Generate a chunk at full resolution and with the given cave noise sample steps and compare the results
+     * Used to pick the coarsest CaveNoiseSampleStep / CaveShapeNoiseSampleStep that is visually safe
+     */
+    UFUNCTION(BlueprintCallable, Category = "Terrain|Optimization")
+    FVoxelSamplingErrorReport MeasureCaveSamplingError(const FChunkCoord& ChunkCoord, int32 CaveStep, int32 ShapeStep) const;
+
+    /** Check if a chunk is provably all air (conservative - never true for a chunk with a surface) */
     UFUNCTION(BlueprintCallable, Category = "Terrain|Optimization")
     bool IsChunkLikelyEmpty(int32 ChunkX, int32 ChunkY, int32 ChunkZ, int32 ChunkSize) const;
 
+    /** Compute the height bounds of a chunk column - shared by every chunk stacked in that column */
+    FVoxelColumnBounds ComputeColumnBounds(int32 ChunkX, int32 ChunkY, int32 ChunkSize) const;
+
+    /**
+     * Classify a chunk from its column bounds
+     * Empty/Solid are only returned when every density sample is provably air/solid, so no surface can exist
+     */
+    EVoxelChunkContent ClassifyChunk(const FVoxelColumnBounds& Bounds, int32 ChunkZ, int32 ChunkSize) const;
+
 protected:
     /** Noise generator instance */
     UPROPERTY()
@@ -128,6 +288,12 @@ protected:
     /** Get peaks and valleys factor - creates mountain ridges */
     float GetPeaksValleys(int32 WorldX, int32 WorldY) const;
 
+    /** Terrain height from precomputed feature influences */
+    float GetTerrainHeightFromInfluences(int32 WorldX, int32 WorldY, float PlateauInf, float ValleyInf, float CanyonInf) const;
+
+    /** Biome classification from precomputed climate and feature values */
+    EBiomeType GetBiomeFromFactors(int32 WorldX, int32 WorldY, float Temperature, float Moisture, float PlateauInf, float ValleyInf) const;
+
     /** Get 3D terrain density variation for overhangs and caves */
     float Get3DTerrainVariation(int32 WorldX, int32 WorldY, int32 WorldZ) const;
 
@@ -138,6 +304,49 @@ protected:
     /** Get shaft vertical parameters (top, bottom, chamber bottom) */
     void GetShaftParameters(float TerrainHeight, float& OutShaftTop, float& OutShaftBottom, float& OutChamberBottom) const;
 
+    /** Entrance influence with a precomputed plateau influence */
+    float GetCaveEntranceInfluenceFromPlateau(int32 WorldX, int32 WorldY, float PlateauInf) const;
+
+    /** Domain-warped ridged noise that shapes the tunnels around entrances */
+    float GetEntranceTunnelNoise(int32 WorldX, int32 WorldY) const;
+
+    /**
+     * Density evaluation that also reports the cave density when it had to be computed
+     * OutCaveDensity is left unset when the density pass did not need it
+     */
+    float EvaluateDensity(const FVoxelColumnData& Column, int32 WorldX, int32 WorldY, int32 WorldZ, TOptional<float>& OutCaveDensity, const float* CaveNoise = nullptr) const;
+
+    /** Material selection from an already evaluated density (and cave density, if known) */
+    EVoxelType GetVoxelTypeFromDensity(const FVoxelColumnData& Column, int32 WorldX, int32 WorldY, int32 WorldZ, float Density, const TOptional<float>& CaveDensity, const float* CaveNoise = nullptr) const;
+
+    /** Column-based versions of the cave queries */
+    bool IsInCaveEntranceFromColumn(const FVoxelColumnData& Column, int32 WorldZ) const;
+    float GetEntranceShaftDensityFromColumn(const FVoxelColumnData& Column, int32 WorldX, int32 WorldY, int32 WorldZ) const;
+    float GetEntranceTunnelDensityFromColumn(const FVoxelColumnData& Column, int32 WorldX, int32 WorldY, int32 WorldZ) const;
+    float GetCaveDensityFromColumn(const FVoxelColumnData& Column, int32 WorldX, int32 WorldY, int32 WorldZ, const float* CaveNoise = nullptr) const;
+
+    /** Combined 3D cave noise at a point (two fractal octave sets) */
+    float GetCaveNoise(int32 WorldX, int32 WorldY, int32 WorldZ) const;
+
+    /** Batched evaluation of one cave noise layer using the vectorized noise path */
+    void GetCaveNoiseLayerBatch(ECaveNoiseLayer Layer, const TArray<FIntVector>& Points, TArray<float>& OutNoise) const;
+
+    /**
+     * Sample one cave noise layer for the given points of a chunk
+     * Step 1 evaluates every point, Step 2/4 evaluates a coarse lattice and trilinearly upsamples
+     * The lattice is world-aligned and extends one cell past each face, so apron points match the neighbour's values
+     */
+    void SampleCaveNoiseLayer(ECaveNoiseLayer Layer, const FIntVector& WorldBase, int32 ChunkSize, int32 Step,
+        const TArray<FIntVector>& Points, TArray<float>& OutNoise) const;
+
+    /** Clamp a requested sample step to 1, 2 or 4 and to a divisor of the chunk size */
+    static int32 GetEffectiveSampleStep(int32 RequestedStep, int32 ChunkSize);
+
+    /** GenerateChunkData with explicit cave noise sample steps */
+    bool GenerateChunkDataSampled(int32 WorldBaseX, int32 WorldBaseY, int32 WorldBaseZ, int32 ChunkSize,
+        int32 CaveStep, int32 ShapeStep, TArray<float>& OutDensity, TArray<EVoxelType>& OutMaterials, const TAtomic<bool>* bCancelled, int32 Apron = 0,
+        int32 DataStep = 1) const;
+
     // ==========================================
     // Biome Feature Generation
     // ==========================================
@@ -145,6 +354,9 @@ protected:
     /** Get the base height for terrain features (plateaus, valleys) */
     float GetFeatureHeight(int32 WorldX, int32 WorldY) const;
 
+    /** Feature height from precomputed influences */
+    float GetFeatureHeightFromInfluences(float PlateauInf, float ValleyInf, float CanyonInf) const;
+
     /** Generate plateau terrain - flat-topped mountains */
     float GetPlateauDensity(int32 WorldX, int32 WorldY, int32 WorldZ, float BaseHeight) const;
 
@@ -162,27 +374,21 @@ protected:
     // ==========================================
 
     /** Determine surface material based on biome and conditions */
-    EVoxelType GetSurfaceBlock(EBiomeType Biome, int32 WorldX, int32 WorldY, int32 WorldZ, float TerrainHeight) const;
+    EVoxelType GetSurfaceBlock(const FVoxelColumnData& Column, int32 WorldZ) const;
 
     /** Determine underground material based on depth and conditions */
     EVoxelType GetUndergroundBlock(int32 WorldZ, float TerrainHeight, EBiomeType Biome) const;
 
     /** Get material for plateau surfaces */
-    EVoxelType GetPlateauMaterial(int32 WorldX, int32 WorldY, int32 WorldZ, float TerrainHeight) const;
+    EVoxelType GetPlateauMaterial(const FVoxelColumnData& Column, int32 WorldZ) const;
 
     /** Get material for valley floors */
-    EVoxelType GetValleyMaterial(int32 WorldX, int32 WorldY, int32 WorldZ, float TerrainHeight) const;
+    EVoxelType GetValleyMaterial(const FVoxelColumnData& Column, int32 WorldZ) const;
 
 private:
-    /** Cached noise values for biome determination (performance optimization) */
-    mutable TMap<uint64, float> CachedBiomeNoise;
+    /** Full column data (terrain + climate) - safe to share between generation threads */
+    mutable FVoxelColumnCache ColumnCache;
 
-    /** Hash function for position caching */
-    FORCEINLINE uint64 HashPosition2D(int32 X, int32 Y) const
-    {
-        // Quantize to reduce cache size while maintaining quality
-        int32 QX = X >> 2; // Divide by 4
-        int32 QY = Y >> 2;
-        return (static_cast<uint64>(QX & 0xFFFFFF) << 24) | static_cast<uint64>(QY & 0xFFFFFF);
-    }
+    /** Evaluate every column value without touching the cache */
+    void ComputeColumnData(int32 WorldX, int32 WorldY, FVoxelColumnData& OutColumn) const;
 };
@@ -28,6 +28,53 @@ enum class EChunkState : uint8
     PendingUnload = 4
 };
 
+/** Conservative classification of a chunk's contents */
+UENUM(BlueprintType)
+enum class EVoxelChunkContent : uint8
+{
+    Surface = 0     UMETA(DisplayName = "Surface (may contain geometry)"),
+    Empty = 1       UMETA(DisplayName = "Empty (provably all air)"),
+    Solid = 2       UMETA(DisplayName = "Solid (provably all solid)")
+};
+
+/** Chunk faces - bit indices of a chunk's LOD transition mask */
+enum class EVoxelChunkFace : uint8
+{
+    NegX = 0,
+    PosX = 1,
+    NegY = 2,
+    PosY = 3,
+    NegZ = 4,
+    PosZ = 5
+};
+
+/** Exact height range and cave possibility over one chunk column's (ChunkSize+1)^2 lattice columns */
+struct VOXELWORLD_API FVoxelColumnBounds
+{
+    float MinHeight = 0.0f;
+    float MaxHeight = 0.0f;
+
+    /** True when no cave, shaft or tunnel can carve any column (caves disabled or solid plateau cores only) */
+    bool bCaveFree = false;
+};
+
+/** 3D noise backend used for terrain generation */
+UENUM(BlueprintType)
+enum class EVoxelNoiseType : uint8
+{
+    Perlin = 0      UMETA(DisplayName = "Perlin (8 corners)"),
+    Simplex = 1     UMETA(DisplayName = "Simplex (4 corners)")
+};
+
+/** Storage precision of chunk density values (density is always clamped to [-1, 1]) */
+UENUM(BlueprintType)
+enum class EVoxelDensityFormat : uint8
+{
+    Float32 = 0     UMETA(DisplayName = "Float (4 bytes)"),
+    SNorm16 = 1     UMETA(DisplayName = "16-bit SNORM (2 bytes)"),
+    SNorm8 = 2      UMETA(DisplayName = "8-bit SNORM (1 byte)")
+};
+
 /** Mesh data structure for chunk generation */
 USTRUCT()
 struct VOXELWORLD_API FVoxelMeshData
@@ -100,6 +147,23 @@ enum class EVoxelType : uint8
     Max UMETA(Hidden)
 };
 
+/** A chunk held as a single fill value - no actor, no voxel arrays, promoted to a real chunk when edited */
+struct FVoxelHomogeneousChunk
+{
+    /** Empty or Solid */
+    EVoxelChunkContent Content = EVoxelChunkContent::Empty;
+
+    /** Most common material of a solid chunk - voxel queries ask the generator for the exact one when it is available */
+    EVoxelType FillMaterial = EVoxelType::Air;
+
+    FVoxelHomogeneousChunk() = default;
+
+    FVoxelHomogeneousChunk(EVoxelChunkContent InContent, EVoxelType InFillMaterial)
+        : Content(InContent), FillMaterial(InFillMaterial)
+    {
+    }
+};
+
 /** Structure representing a single voxel */
 USTRUCT(BlueprintType)
 struct VOXELWORLD_API FVoxel
@@ -323,6 +387,62 @@ struct VOXELWORLD_API FBiomeSettings
     bool bEnableCanyons = true;
 };
 
+/** One streaming stage's game-thread work in the last frame */
+USTRUCT(BlueprintType)
+struct VOXELWORLD_API FVoxelStageStats
+{
+    GENERATED_BODY()
+
+    /** Time the stage was allowed (after adaptive scaling) */
+    UPROPERTY(BlueprintReadOnly, Category = "Performance")
+    float BudgetMs = 0.0f;
+
+    /** Time the stage actually took */
+    UPROPERTY(BlueprintReadOnly, Category = "Performance")
+    float UsedMs = 0.0f;
+
+    /** Items handled */
+    UPROPERTY(BlueprintReadOnly, Category = "Performance")
+    int32 Processed = 0;
+
+    /** Items left for later frames */
+    UPROPERTY(BlueprintReadOnly, Category = "Performance")
+    int32 Remaining = 0;
+};
+
+/** Per-stage budget use of the last frame, plus the adaptive controller's state */
+USTRUCT(BlueprintType)
+struct VOXELWORLD_API FVoxelStreamingStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Performance")
+    FVoxelStageStats Generation;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Performance")
+    FVoxelStageStats Spawn;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Performance")
+    FVoxelStageStats MeshBuild;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Performance")
+    FVoxelStageStats MeshUpload;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Performance")
+    FVoxelStageStats Collision;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Performance")
+    FVoxelStageStats Recycle;
+
+    /** Smoothed frame time the controller reacts to */
+    UPROPERTY(BlueprintReadOnly, Category = "Performance")
+    float FrameTimeMs = 0.0f;
+
+    /** Multiplier currently applied to every stage budget */
+    UPROPERTY(BlueprintReadOnly, Category = "Performance")
+    float BudgetScale = 1.0f;
+};
+
 /** World generation settings - with performance optimizations */
 USTRUCT(BlueprintType)
 struct VOXELWORLD_API FVoxelWorldSettings
@@ -365,6 +485,10 @@ struct VOXELWORLD_API FVoxelWorldSettings
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Generation", meta = (ClampMin = "1", ClampMax = "8"))
     int32 NoiseOctaves = 4;
 
+    /** 3D noise backend - Simplex samples 4 lattice corners instead of 8 (changes the generated world) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Generation")
+    EVoxelNoiseType NoiseType = EVoxelNoiseType::Perlin;
+
     /** Enable cave generation */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Generation")
     bool bGenerateCaves = true;
@@ -373,6 +497,14 @@ struct VOXELWORLD_API FVoxelWorldSettings
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Generation", meta = (ClampMin = "0.0", ClampMax = "1.0"))
     float CaveThreshold = 0.5f;
 
+    /** Sample step for the detailed cave noise (1 = every voxel, 2 or 4 = coarse lattice + trilinear upsampling) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Generation", meta = (ClampMin = "1", ClampMax = "4", EditCondition = "bGenerateCaves"))
+    int32 CaveNoiseSampleStep = 1;
+
+    /** Sample step for the large-scale cave shape noise (1 = every voxel, 2 or 4 = coarse lattice + trilinear upsampling) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Generation", meta = (ClampMin = "1", ClampMax = "4", EditCondition = "bGenerateCaves"))
+    int32 CaveShapeNoiseSampleStep = 1;
+
     /** Terrain smoothness */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Generation", meta = (ClampMin = "0.0", ClampMax = "1.0"))
     float TerrainSmoothness = 0.5f;
@@ -397,14 +529,50 @@ struct VOXELWORLD_API FVoxelWorldSettings
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
     bool bAsyncCollisionCooking = true;
 
-    /** Number of chunks to generate per frame - increase for faster loading */
+    /** Upper bound on chunks started per frame, on top of GenerationBudgetMs (keeps the worker pool from flooding) */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance", meta = (ClampMin = "1", ClampMax = "32"))
     int32 ChunksPerFrame = 8;
 
-    /** Number of mesh builds per frame - increase for faster loading */
+    /** Upper bound on mesh builds started per frame, on top of MeshBuildBudgetMs */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance", meta = (ClampMin = "1", ClampMax = "16"))
     int32 MeshBuildsPerFrame = 6;
 
+    /** Game thread time per frame spent classifying queued chunks and starting their generation */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance", meta = (ClampMin = "0.1", ClampMax = "33.0"))
+    float GenerationBudgetMs = 1.5f;
+
+    /** Game thread time per frame spent publishing generated data and spawning chunk actors */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance", meta = (ClampMin = "0.1", ClampMax = "33.0"))
+    float SpawnBudgetMs = 1.5f;
+
+    /** Game thread time per frame spent starting mesh builds (neighbour and apron sync, or the whole build if not async) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance", meta = (ClampMin = "0.1", ClampMax = "33.0"))
+    float MeshBuildBudgetMs = 2.0f;
+
+    /** Run marching cubes on worker threads - the game thread only uploads finished meshes */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
+    bool bAsyncMeshing = true;
+
+    /** Game thread time per frame spent uploading finished meshes (at least one upload always happens) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance", meta = (ClampMin = "0.1", ClampMax = "33.0", EditCondition = "bAsyncMeshing"))
+    float MeshUploadBudgetMs = 2.0f;
+
+    /** Game thread time per frame spent switching chunk collision on or off */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance", meta = (ClampMin = "0.1", ClampMax = "33.0"))
+    float CollisionBudgetMs = 0.5f;
+
+    /** Game thread time per frame spent recycling chunks that left the render distance */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance", meta = (ClampMin = "0.1", ClampMax = "33.0"))
+    float RecycleBudgetMs = 1.0f;
+
+    /** Scale every stage budget up or down to hold TargetFrameRate (each stage still makes progress every frame) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
+    bool bAdaptiveBudgets = true;
+
+    /** Frame rate the adaptive budgets aim for - keep it at or below any frame rate cap, or budgets never grow */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance", meta = (ClampMin = "10", ClampMax = "240", EditCondition = "bAdaptiveBudgets"))
+    float TargetFrameRate = 60.0f;
+
     /** Enable chunk pooling to reduce allocations */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
     bool bEnableChunkPooling = true;
@@ -417,7 +585,10 @@ struct VOXELWORLD_API FVoxelWorldSettings
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
     bool bDeduplicateVertices = true;
 
-    /** Unload voxel data from chunks beyond this distance (0 = never unload) */
+    /**
+     * Move voxel data of chunks beyond this distance to the cold tier, keeping their meshes (0 = never unload)
+     * The arrays are dropped and only the chunk's edit layer stays, LZ4-compressed; the data is regenerated on a worker when needed again
+     */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance", meta = (ClampMin = "0", ClampMax = "64"))
     int32 DataUnloadDistance = 16;
 
@@ -425,7 +596,23 @@ struct VOXELWORLD_API FVoxelWorldSettings
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
     bool bSkipEmptyChunks = true;
 
-    /** Prioritize chunks in camera view direction */
+    /** Generate chunks only at the lattice points their LOD step meshes (regenerated at full resolution when promoted or edited) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
+    bool bReducedResolutionGeneration = true;
+
+    /** Precision chunks store density at - quantized formats cut density memory to a half or a quarter */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
+    EVoxelDensityFormat DensityFormat = EVoxelDensityFormat::Float32;
+
+    /** Prioritize chunks in camera view direction and along the direction of travel (view set by UVoxelPlayerTracker or SetViewInfo) */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
     bool bPrioritizeViewDirection = true;
+
+    /** Save terrain edits to region files when chunks unload, and load them back when chunks return (opt-in, not in editor preview) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Persistence")
+    bool bPersistEdits = false;
+
+    /** Folder under Saved/VoxelWorld the region files go to - one subfolder per seed */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Persistence", meta = (EditCondition = "bPersistEdits"))
+    FString SaveSlotName = TEXT("Default");
 };
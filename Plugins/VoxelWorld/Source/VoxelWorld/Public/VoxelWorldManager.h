@@ -5,32 +5,122 @@
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
 #include "VoxelTypes.h"
+#include "VoxelMarchingCubes.h"
+#include "VoxelChunkStore.h"
+#include "VoxelPriorityQueue.h"
 #include "HAL/ThreadSafeBool.h"
+#include "Containers/Queue.h"
+#include "Tasks/Task.h"
 #include "VoxelWorldManager.generated.h"
 
 class AVoxelChunk;
+class AVoxelWorldManager;
 class UVoxelTerrainGenerator;
+class FVoxelRegionStore;
 
-/** Async task for chunk generation - with safe cancellation */
+/** A finished generation job on its way back to the game thread */
+struct FVoxelGenerationCompletion
+{
+    /** Streaming epoch the job was started in - results from before the last DestroyAllChunks are dropped */
+    uint32 Epoch = 0;
+
+    /** Store entry the result belongs to - checked before the job is looked at */
+    FVoxelChunkHandle Handle;
+
+    TSharedPtr<FVoxelGenerationJob, ESPMode::ThreadSafe> Job;
+};
+
+/** A finished meshing job waiting for its game-thread upload */
+struct FCompletedMeshingJob
+{
+    uint32 Epoch = 0;
+    TWeakObjectPtr<AVoxelChunk> Chunk;
+    TSharedPtr<FVoxelMeshingJob, ESPMode::ThreadSafe> Job;
+};
+
+/**
+ * Lock-free hand-off from workers to the game thread - any number of tasks push, the manager drains once per tick
+ * Shared with every task along with the task bookkeeping, so a task that outlives the manager only ever writes here
+ */
+struct FVoxelCompletionQueues
+{
+    TQueue<FVoxelGenerationCompletion, EQueueMode::Mpsc> Generation;
+    TQueue<FCompletedMeshingJob, EQueueMode::Mpsc> Meshing;
+
+    /** Set on shutdown - tasks that have not started skip their work */
+    FThreadSafeBool bCancelled;
+
+    /** Tasks started and not yet finished, counted down by the tasks themselves */
+    TAtomic<int32> NumActiveTasks{0};
+
+    /** Set while a save task is writing */
+    TAtomic<bool> bRegionSaveInFlight{false};
+};
+
+/** Async task for chunk generation - fills a headless job, never touches a chunk actor or the store */
 class FChunkGenerationTask : public FNonAbandonableTask
 {
 public:
-    FChunkGenerationTask(AVoxelChunk* InChunk, FThreadSafeBool* InCancelFlag)
-        : Chunk(InChunk)
-        , CancelFlag(InCancelFlag)
+    FChunkGenerationTask(const TSharedRef<FVoxelGenerationJob, ESPMode::ThreadSafe>& InJob,
+        const TSharedRef<FVoxelCompletionQueues, ESPMode::ThreadSafe>& InCompletions, uint32 InEpoch);
+
+    FORCEINLINE TStatId GetStatId() const
+    {
+        RETURN_QUICK_DECLARE_CYCLE_STAT(FChunkGenerationTask, STATGROUP_ThreadPoolAsyncTasks);
+    }
+
+    void DoWork();
+
+private:
+    TSharedRef<FVoxelGenerationJob, ESPMode::ThreadSafe> Job;
+
+    TSharedRef<FVoxelCompletionQueues, ESPMode::ThreadSafe> Completions;
+    uint32 Epoch;
+};
+
+/** Async task for marching cubes - works only on the job's snapshot, never on the chunk actor */
+class FChunkMeshingTask : public FNonAbandonableTask
+{
+public:
+    FChunkMeshingTask(const TSharedRef<FVoxelMeshingJob, ESPMode::ThreadSafe>& InJob, AVoxelChunk* InChunk,
+        const TSharedRef<FVoxelCompletionQueues, ESPMode::ThreadSafe>& InCompletions, uint32 InEpoch);
+
+    FORCEINLINE TStatId GetStatId() const
     {
+        RETURN_QUICK_DECLARE_CYCLE_STAT(FChunkMeshingTask, STATGROUP_ThreadPoolAsyncTasks);
     }
 
+    void DoWork();
+
+private:
+    TSharedRef<FVoxelMeshingJob, ESPMode::ThreadSafe> Job;
+
+    /** Only dereferenced back on the game thread */
+    TWeakObjectPtr<AVoxelChunk> Chunk;
+
+    TSharedRef<FVoxelCompletionQueues, ESPMode::ThreadSafe> Completions;
+    uint32 Epoch;
+};
+
+/** Async task writing queued chunk saves to region files - never cancelled, so unloaded edits always reach disk */
+class FRegionSaveTask : public FNonAbandonableTask
+{
+public:
+    FRegionSaveTask(const TSharedRef<FVoxelRegionStore, ESPMode::ThreadSafe>& InRegionStore,
+        const TSharedRef<FVoxelCompletionQueues, ESPMode::ThreadSafe>& InCompletions);
+
     FORCEINLINE TStatId GetStatId() const
     {
-        RETURN_QUICK_DECLARE_CYCLE_STAT(FChunkGenerationTask, STATGROUP_ThreadPoolAsyncTasks);
+        RETURN_QUICK_DECLARE_CYCLE_STAT(FRegionSaveTask, STATGROUP_ThreadPoolAsyncTasks);
     }
 
     void DoWork();
 
 private:
-    AVoxelChunk* Chunk;
-    FThreadSafeBool* CancelFlag;
+    TSharedRef<FVoxelRegionStore, ESPMode::ThreadSafe> RegionStore;
+
+    /** Holds the in-flight flag and task count */
+    TSharedRef<FVoxelCompletionQueues, ESPMode::ThreadSafe> Completions;
 };
 
 /**
@@ -91,6 +181,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Voxel World")
     void SetLoadCenter(const FVector& WorldPosition);
 
+    /**
+     * Set the camera view and player velocity queued work is scored against (used when bPrioritizeViewDirection is set)
+     * Chunks in the view cone and along the direction of travel are generated and meshed first
+     */
+    UFUNCTION(BlueprintCallable, Category = "Voxel World")
+    void SetViewInfo(const FVector& ViewLocation, const FVector& ViewDirection, float FOVDegrees, const FVector& Velocity);
+
     /** Get voxel at world position */
     UFUNCTION(BlueprintCallable, Category = "Voxel World")
     FVoxel GetVoxelAtWorldPosition(const FVector& WorldPosition) const;
@@ -103,6 +200,18 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Voxel World")
     AVoxelChunk* GetChunk(const FChunkCoord& ChunkCoord) const;
 
+    /**
+     * Get the chunk at a coordinate, spawning and synchronously generating it if it was skipped as all-air/all-solid,
+     * and bringing its data back if it was in the cold tier
+     * Use before editing so digging or building into a skipped or far chunk still works
+     */
+    UFUNCTION(BlueprintCallable, Category = "Voxel World")
+    AVoxelChunk* GetOrMaterializeChunk(const FChunkCoord& ChunkCoord);
+
+    /** Check if a chunk coordinate was skipped because it provably contains no surface */
+    UFUNCTION(BlueprintCallable, Category = "Voxel World")
+    bool IsChunkSkipped(const FChunkCoord& ChunkCoord) const { return SkippedChunks.Contains(ChunkCoord); }
+
     /** Convert world position to chunk coordinate */
     UFUNCTION(BlueprintCallable, Category = "Voxel World")
     FChunkCoord WorldToChunkCoord(const FVector& WorldPosition) const;
@@ -131,6 +240,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Voxel World|Performance")
     float GetMemoryUsageMB() const;
 
+    /** Get memory saved by quantized density storage in MB (already excluded from GetMemoryUsageMB) */
+    UFUNCTION(BlueprintCallable, Category = "Voxel World|Performance")
+    float GetDensityMemorySavedMB() const;
+
     /** Get number of chunks in pool */
     UFUNCTION(BlueprintCallable, Category = "Voxel World|Performance")
     int32 GetPooledChunkCount() const { return ChunkPool.Num(); }
@@ -142,6 +255,19 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Voxel World")
     void QueueChunkForRebuild(AVoxelChunk* Chunk);
 
+    /** Receive a finished meshing job on the game thread (drained from the completion queue) */
+    void OnMeshingJobCompleted(const TWeakObjectPtr<AVoxelChunk>& Chunk, const TSharedRef<FVoxelMeshingJob, ESPMode::ThreadSafe>& Job);
+
+    /** Receive a finished generation job on the game thread - published under SpawnBudgetMs (drained from the completion queue, or inline when synchronous) */
+    void OnGenerationJobCompleted(const TSharedRef<FVoxelGenerationJob, ESPMode::ThreadSafe>& Job);
+
+    /** Budget use of every streaming stage in the last frame */
+    UFUNCTION(BlueprintCallable, Category = "Voxel World|Performance")
+    FVoxelStreamingStats GetStreamingStats() const { return StreamingStats; }
+
+    /** Voxel data of every generated chunk, with or without an actor */
+    const FVoxelChunkStore& GetChunkStore() const { return ChunkStore; }
+
 protected:
     virtual void BeginPlay() override;
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
@@ -164,17 +290,114 @@ protected:
     UPROPERTY()
     TArray<TObjectPtr<AVoxelChunk>> ChunkPool;
 
-    /** Queue of chunks waiting to be generated */
-    TArray<FChunkCoord> ChunkGenerationQueue;
+    /** Voxel data for every chunk being generated or loaded - actors only render it */
+    FVoxelChunkStore ChunkStore;
+
+    /** Saved edits of unloaded chunks (null when persistence is off or in editor preview) */
+    TSharedPtr<FVoxelRegionStore, ESPMode::ThreadSafe> RegionStore;
+
+    /** Generation jobs started but not yet published, by coordinate (at most one live job per chunk) */
+    TMap<FChunkCoord, TSharedRef<FVoxelGenerationJob, ESPMode::ThreadSafe>> PendingGenerationJobs;
+
+    /** Chunks waiting to be generated, lowest GetChunkPriority first */
+    TVoxelPriorityQueue<FChunkCoord> ChunkGenerationQueue;
+
+    /** Chunks waiting for mesh building, lowest GetChunkPriority first */
+    TVoxelPriorityQueue<AVoxelChunk*> MeshBuildQueue;
+
+    /**
+     * Job graph generation nodes - one event per coordinate a parked mesh build depends on,
+     * triggered once the coordinate has no generation queued or running
+     */
+    TMap<FChunkCoord, UE::Tasks::FTaskEvent> GenerationNodes;
+
+    /** Chunks whose mesh build is parked behind GenerationNodes (kept off MeshBuildQueue until a gate task releases them) */
+    TSet<FChunkCoord> ChunksAwaitingGeneration;
+
+    /** Meshes built on workers, uploaded under MeshUploadBudgetMs each frame */
+    TArray<FCompletedMeshingJob> CompletedMeshJobs;
+
+    /** Generation jobs finished but not yet published, published under SpawnBudgetMs each frame */
+    TArray<TSharedRef<FVoxelGenerationJob, ESPMode::ThreadSafe>> CompletedGenerationJobs;
+
+    /** Chunks whose collision no longer matches their distance, switched under CollisionBudgetMs each frame */
+    TArray<FChunkCoord> CollisionUpdateQueue;
+
+    /** Chunks that left the interest set, recycled under RecycleBudgetMs each frame */
+    TArray<FChunkCoord> RecycleQueue;
+
+    /** Adaptive controller - multiplier on every stage budget and the smoothed frame time it tracks */
+    float BudgetScale = 1.0f;
+    float SmoothedFrameTimeMs = 0.0f;
+
+    /** Budget use of the last frame */
+    FVoxelStreamingStats StreamingStats;
+
+    /** Controller limits - budgets never drop below a quarter or grow past four times their setting */
+    static constexpr float MinBudgetScale = 0.25f;
+    static constexpr float MaxBudgetScale = 4.0f;
 
-    /** Queue of chunks waiting for mesh building */
-    TArray<AVoxelChunk*> MeshBuildQueue;
+    /** Per-stage floor in the editor preview, which has no frame rate to protect */
+    static constexpr float EditorPreviewBudgetMs = 16.0f;
+
+    /** Meshing tasks started but not yet reported back */
+    int32 NumMeshTasksInFlight = 0;
+
+    /** Results pushed by workers, drained at the start of every tick - also owns the cancel flag and task count */
+    TSharedRef<FVoxelCompletionQueues, ESPMode::ThreadSafe> Completions = MakeShared<FVoxelCompletionQueues, ESPMode::ThreadSafe>();
+
+    /** Bumped by DestroyAllChunks - tasks are stamped with it so their results can be told apart from the current world's */
+    uint32 StreamingEpoch = 0;
+
+    /** Next meshing task id (0 is reserved for "none") */
+    uint32 NextMeshTaskId = 1;
+
+    /**
+     * In-range chunks held as a fill value instead of an actor - either classified all air/all solid up front,
+     * or demoted after generation found no surface
+     */
+    TMap<FChunkCoord, FVoxelHomogeneousChunk> SkippedChunks;
+
+    /** Column height bounds per XY chunk column - shared by every chunk in the column */
+    TMap<FIntPoint, FVoxelColumnBounds> ColumnBoundsCache;
 
     /** Current load center in chunk coordinates */
     FChunkCoord CurrentLoadCenter;
 
-    /** Cancel flag for async tasks - prevents memory leak when stopping */
-    FThreadSafeBool bCancelAsyncTasks;
+    /**
+     * Interest set - every chunk within InterestRadius columns of InterestCenter, for Z in [0, InterestHeight)
+     * Kept in step with the load centre by visiting only the shells that enter and leave (INDEX_NONE radius = not built yet)
+     */
+    FChunkCoord InterestCenter;
+    int32 InterestRadius = INDEX_NONE;
+    int32 InterestHeight = 0;
+
+    /** Half-width of each row of the interest disk, indexed by row offset + InterestRadius */
+    TArray<int32> InterestRowHalfWidths;
+
+    /** Latest view from SetViewInfo */
+    FVector ViewOrigin = FVector::ZeroVector;
+    FVector ViewForward = FVector::ForwardVector;
+    FVector ViewVelocity = FVector::ZeroVector;
+    float ViewCosHalfFOV = 0.5f;
+    bool bHasViewInfo = false;
+
+    /** View the queues were last scored against */
+    FVector ScoredViewOrigin = FVector::ZeroVector;
+    FVector ScoredViewForward = FVector::ForwardVector;
+    FVector ScoredViewVelocity = FVector::ZeroVector;
+
+    /** Set when the view or load centre moved enough to reorder the queues - rescored before the next pop */
+    bool bQueuePrioritiesDirty = false;
+
+    /** Share of a chunk's distance taken off inside the view cone (and added, halved, directly behind) */
+    static constexpr float ViewDirectionWeight = 0.5f;
+
+    /** Share of a chunk's distance taken off along the direction of travel at full speed */
+    static constexpr float VelocityWeight = 0.3f;
+
+    /** View turns smaller than this (cosine of ~10 degrees) keep the current scores */
+    static constexpr float ViewRescoreCosAngle = 0.985f;
 
     /** Timers for periodic updates */
     float LODUpdateTimer = 0.0f;
@@ -206,24 +429,130 @@ protected:
     /** Destroy all chunks and clear pools */
     void DestroyAllChunks();
 
-    /** Update chunk loading/unloading based on distance */
+    /** Update chunk loading/unloading based on distance - incremental unless the render distance or height changed */
     void UpdateChunkLoading();
 
+    /** Check if a chunk lies inside the interest set */
+    bool IsInInterestSet(const FChunkCoord& ChunkCoord) const;
+
+    /** Drop every chunk of a column that left the interest set */
+    void UnloadColumn(int32 X, int32 Y);
+
+    /** Drop everything outside the interest set (full sweep, used when the set is rebuilt) */
+    void UnloadOutsideInterestSet();
+
+    /** Add a chunk to the generation queue unless it is already queued */
+    void EnqueueChunkGeneration(const FChunkCoord& ChunkCoord);
+
     /** Update LOD levels for all chunks based on distance */
     void UpdateChunkLODs();
 
-    /** Update collision states for all chunks based on distance */
+    /** Queue chunks whose collision state no longer matches their distance */
     void UpdateChunkCollisions();
 
-    /** Process chunk generation queue */
+    /** Switch queued chunks' collision until the budget is spent */
+    void ProcessCollisionUpdates();
+
+    /** Recycle chunks that left the interest set until the budget is spent (chunks that came back are kept) */
+    void ProcessRecycleQueue();
+
+    /** Move everything workers pushed since the last tick into the budgeted completion stages */
+    void DrainCompletionQueues();
+
+    /** Classify queued chunks and start their generation until the budget is spent */
     void ProcessGenerationQueue();
 
-    /** Process mesh build queue */
+    /** Publish finished generation jobs until the budget is spent */
+    void ProcessGenerationCompletions();
+
+    /** Publish one finished generation job, spawning a chunk actor only if the data has a surface */
+    void PublishGenerationJob(const TSharedRef<FVoxelGenerationJob, ESPMode::ThreadSafe>& Job);
+
+    /** Move the budget scale towards holding TargetFrameRate, from the last frame's time */
+    void UpdateFrameBudget(float DeltaTime);
+
+    /** Seconds a stage may spend this frame - its setting scaled by the controller */
+    double GetStageBudgetSeconds(float BudgetMs) const;
+
+    /** Fill a stage's stats at the end of its loop */
+    static void RecordStage(FVoxelStageStats& Stats, double StartTime, double BudgetSeconds, int32 Processed, int32 Remaining);
+
+    /**
+     * Generate a chunk's data without an actor - on a worker, or inline for the editor preview and synchronous generation
+     * Edits already in the chunk's entry are reapplied to the result
+     */
+    void StartGenerationJob(const FChunkCoord& ChunkCoord, int32 DataStep);
+
+    /** Move data of chunks beyond DataUnloadDistance to the cold tier, and start restoring chunks that came back in range */
+    void UpdateChunkResidency();
+
+    /** Bring a chunk's cold data back on a worker - regenerated with its edit layer reapplied */
+    void RequestDataRestore(AVoxelChunk* Chunk);
+
+    /** Cancel a chunk's pending generation, queue its edits for saving and drop its store entry */
+    void ReleaseChunkData(const FChunkCoord& ChunkCoord);
+
+    /** Queue a chunk's entry for saving if it has edits that are not on disk yet */
+    void QueueChunkSave(const FChunkCoord& ChunkCoord);
+
+    /** Write queued saves on a worker, unless a save task is already running */
+    void StartRegionSaveTask();
+
+    /** Start mesh builds for queued chunks until the budget is spent */
     void ProcessMeshBuildQueue();
 
+    /** Start a worker-thread mesh build from a snapshot of the chunk */
+    void StartMeshingTask(AVoxelChunk* Chunk);
+
+    /** Check if a chunk is queued for or running generation */
+    bool HasOutstandingGeneration(const FChunkCoord& ChunkCoord) const;
+
+    /**
+     * Park a chunk's mesh build behind the outstanding generation of itself and its face neighbours
+     * A game-thread gate task with their generation nodes as prerequisites puts it back on the mesh queue
+     * @return False if none of that generation is outstanding and the mesh can be built now
+     */
+    bool DeferMeshUntilGenerated(AVoxelChunk* Chunk);
+
+    /** Trigger the generation nodes of coordinates that were published, skipped, cancelled or left range */
+    void ResolveGenerationNodes();
+
+    /** Gate task body - requeue a parked chunk if it is still loaded and in range, and the world was not rebuilt since */
+    void OnMeshPrerequisitesMet(const FChunkCoord& ChunkCoord, uint32 Epoch);
+
+    /** Trigger every generation node so no gate task is left waiting (the gates then find nothing to requeue) */
+    void ReleaseGenerationNodes();
+
+    /** Upload finished meshes until the per-frame budget is spent */
+    void ProcessMeshUploads();
+
     /** Update neighbor references for a chunk */
     void UpdateChunkNeighbors(AVoxelChunk* Chunk);
 
+    /**
+     * Exchange apron data with all 26 neighbours: pull their owned voxels into this chunk's apron and push
+     * this chunk's owned voxels into theirs, queueing any neighbour whose apron changed for a rebuild
+     */
+    void SyncChunkApron(AVoxelChunk* Chunk);
+
+    /**
+     * Conservatively classify a chunk's contents using cached column bounds
+     * @param bOutComputedBounds - set when the column's bounds had to be computed (costs one column pass)
+     */
+    EVoxelChunkContent ClassifyChunkContent(const FChunkCoord& ChunkCoord, bool& bOutComputedBounds);
+
+    /**
+     * Replace a generated chunk with no surface by its fill value, returning the actor to the pool
+     * @return True if the chunk was demoted (the pointer must not be used afterwards)
+     */
+    bool TryDemoteHomogeneousChunk(AVoxelChunk* Chunk);
+
+    /**
+     * Raycast hit test - negative density is solid, the same predicate FindAirBlock skips on
+     * (dug voxels keep their material, so a material test would disagree with the skip)
+     */
+    bool IsSolidAtWorldPosition(const FVector& WorldPosition) const;
+
     // ==========================================
     // Distance Calculations
     // ==========================================
@@ -234,8 +563,11 @@ protected:
     /** Get LOD level for a chunk based on distance */
     EVoxelLOD GetLODForDistance(float Distance) const;
 
-    /** Sort chunks by distance from load center */
-    void SortQueueByDistance(TArray<FChunkCoord>& Queue);
+    /** Queue priority of a chunk - its distance, scaled down in the view cone and along the direction of travel */
+    float GetChunkPriority(const FChunkCoord& ChunkCoord) const;
+
+    /** Recompute every queued priority if the view or load centre changed since the last scoring */
+    void RescoreQueuesIfDirty();
 
     /** Get effective render distance (editor vs runtime) */
     int32 GetEffectiveRenderDistance() const;
@@ -247,9 +579,6 @@ protected:
     /** Wait for all async tasks to complete (called during shutdown) */
     void WaitForAsyncTasks();
 
-    /** Counter for active async tasks */
-    TAtomic<int32> ActiveAsyncTasks{0};
-
 #if WITH_EDITOR
     void InitializeEditorPreview();
     bool IsInEditorPreviewMode() const;